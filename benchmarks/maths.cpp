@@ -0,0 +1,240 @@
+/***************************************************************************************************
+ * @file  maths.cpp
+ * @brief Microbenchmarks of the maths library and of the camera, built with several sets of flags
+ * so that their timings can be compared
+ **************************************************************************************************/
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "Camera.hpp"
+#include "maths/geometry.hpp"
+#include "maths/Matrix4.hpp"
+#include "maths/transformations.hpp"
+#include "maths/vec2.hpp"
+#include "maths/vec3.hpp"
+#include "maths/vec4.hpp"
+
+static constexpr size_t POINT_COUNT = 1024;
+
+/**
+ * @brief Measures an operation, whose mean duration in ns is then reported for each iteration.
+ * The compiler has to assume that the operands change before each iteration, so the operation
+ * can be neither calculated at compile time nor moved out of the loop.
+ * @param state The state of the benchmark.
+ * @param operation The operation.
+ * @param operands The operands of the operation.
+ */
+template<typename Operation, typename... Operands>
+static void measure(benchmark::State& state, const Operation& operation, Operands... operands) {
+    for(auto _ : state) {
+        // The addresses escape rather than the operands themselves: GCC reads floats and vec2
+        // passed to DoNotOptimize from the wrong place in the stack
+        (benchmark::DoNotOptimize(&operands), ...);
+
+        const auto result = operation(operands...);
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+/**
+ * @brief Calculates a matrix that is far from singular, with random values around a diagonal of 4.
+ * @return The matrix.
+ */
+static Matrix4 randomMatrix() {
+    std::mt19937 generator(0u);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    Matrix4 mat(4.0f);
+    for(int i = 0 ; i < 4 ; ++i) {
+        for(int j = 0 ; j < 4 ; ++j) {
+            mat[i][j] += distribution(generator);
+        }
+    }
+
+    return mat;
+}
+
+/**
+ * @brief Calculates points at random positions in the cube between -1 and 1.
+ * @return The points.
+ */
+static std::vector<Point> randomPoints() {
+    std::mt19937 generator(0u);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    std::vector<Point> points(POINT_COUNT);
+    for(Point& point : points) {
+        point = Point(distribution(generator), distribution(generator), distribution(generator));
+    }
+
+    return points;
+}
+
+// Vectors
+
+template<typename Vec>
+static void addition(benchmark::State& state) {
+    measure(state, [](const Vec& left, const Vec& right) { return left + right; },
+            Vec(1.5f), Vec(0.25f));
+}
+
+template<typename Vec>
+static void subtraction(benchmark::State& state) {
+    measure(state, [](const Vec& left, const Vec& right) { return left - right; },
+            Vec(1.5f), Vec(0.25f));
+}
+
+template<typename Vec>
+static void multiplication(benchmark::State& state) {
+    measure(state, [](const Vec& left, const Vec& right) { return left * right; },
+            Vec(1.5f), Vec(0.25f));
+}
+
+template<typename Vec>
+static void division(benchmark::State& state) {
+    measure(state, [](const Vec& left, const Vec& right) { return left / right; },
+            Vec(1.5f), Vec(0.25f));
+}
+
+template<typename Vec>
+static void scalarMultiplication(benchmark::State& state) {
+    measure(state, [](const Vec& vec, float scalar) { return vec * scalar; }, Vec(1.5f), 0.25f);
+}
+
+template<typename Vec>
+static void scalarDivision(benchmark::State& state) {
+    measure(state, [](const Vec& vec, float scalar) { return vec / scalar; }, Vec(1.5f), 0.25f);
+}
+
+template<typename Vec>
+static void vecNormalize(benchmark::State& state) {
+    measure(state, [](const Vec& vec) { return normalize(vec); }, Vec(1.5f));
+}
+
+static void vec3Cross(benchmark::State& state) {
+    measure(state, [](const Vector& left, const Vector& right) { return cross(left, right); },
+            Vector(1.0f, 2.0f, 3.0f), Vector(-2.0f, 0.5f, 1.0f));
+}
+
+BENCHMARK(addition<vec2>);
+BENCHMARK(addition<vec3>);
+BENCHMARK(addition<vec4>);
+BENCHMARK(subtraction<vec2>);
+BENCHMARK(subtraction<vec3>);
+BENCHMARK(subtraction<vec4>);
+BENCHMARK(multiplication<vec2>);
+BENCHMARK(multiplication<vec3>);
+BENCHMARK(multiplication<vec4>);
+BENCHMARK(division<vec2>);
+BENCHMARK(division<vec3>);
+BENCHMARK(division<vec4>);
+BENCHMARK(scalarMultiplication<vec2>);
+BENCHMARK(scalarMultiplication<vec3>);
+BENCHMARK(scalarMultiplication<vec4>);
+BENCHMARK(scalarDivision<vec2>);
+BENCHMARK(scalarDivision<vec3>);
+BENCHMARK(scalarDivision<vec4>);
+BENCHMARK(vecNormalize<vec2>);
+BENCHMARK(vecNormalize<vec3>);
+BENCHMARK(vecNormalize<vec4>);
+BENCHMARK(vec3Cross);
+
+// Matrices
+
+static void matrixMultiplication(benchmark::State& state) {
+    measure(state, [](const Matrix4& left, const Matrix4& right) { return left * right; },
+            randomMatrix(), transpose(randomMatrix()));
+}
+
+static void matrixTranspose(benchmark::State& state) {
+    measure(state, [](const Matrix4& mat) { return transpose(mat); }, randomMatrix());
+}
+
+static void matrixInverse(benchmark::State& state) {
+    measure(state, [](const Matrix4& mat) { return inverse(mat); }, randomMatrix());
+}
+
+static void matrixAffineInverse(benchmark::State& state) {
+    measure(state, [](const Matrix4& mat) { return affineInverse(mat); },
+            translate(1.0f, 2.0f, 3.0f) * rotate(30.0f, Vector(1.0f, 2.0f, 3.0f)) * scale(2.0f));
+}
+
+BENCHMARK(matrixMultiplication);
+BENCHMARK(matrixTranspose);
+BENCHMARK(matrixInverse);
+BENCHMARK(matrixAffineInverse);
+
+// Transformations
+
+static void transformationRotate(benchmark::State& state) {
+    measure(state, [](float angle, const Vector& axis) { return rotate(angle, axis); },
+            30.0f, Vector(1.0f, 2.0f, 3.0f));
+}
+
+static void transformationLookAt(benchmark::State& state) {
+    measure(state, [](const Point& eye, const Point& center, const Vector& up) {
+        return lookAt(eye, center, up);
+    }, Point(1.0f, 2.0f, 3.0f), Point(0.0f, 0.0f, 0.0f), Vector(0.0f, 1.0f, 0.0f));
+}
+
+static void transformationPerspective(benchmark::State& state) {
+    measure(state, [](float fov, float aspect, float near, float far) {
+        return perspective(fov, aspect, near, far);
+    }, radians(45.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+}
+
+// The batched transforms are reported for the whole array and per point
+static void transformationPoints(benchmark::State& state) {
+    const Matrix4 mat = translate(1.0f, 2.0f, 3.0f) * rotate(30.0f, Vector(1.0f, 2.0f, 3.0f));
+    const std::vector<Point> points = randomPoints();
+    std::vector<Point> result(POINT_COUNT);
+
+    for(auto _ : state) {
+        transformPoints(mat, points, result);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * POINT_COUNT);
+}
+
+static void transformationVectors(benchmark::State& state) {
+    const Matrix4 mat = translate(1.0f, 2.0f, 3.0f) * rotate(30.0f, Vector(1.0f, 2.0f, 3.0f));
+    const std::vector<Vector> vectors = randomPoints();
+    std::vector<Vector> result(POINT_COUNT);
+
+    for(auto _ : state) {
+        transformVectors(mat, vectors, result);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * POINT_COUNT);
+}
+
+BENCHMARK(transformationRotate);
+BENCHMARK(transformationLookAt);
+BENCHMARK(transformationPerspective);
+BENCHMARK(transformationPoints);
+BENCHMARK(transformationVectors);
+
+// Camera
+
+static void cameraLook(benchmark::State& state) {
+    Camera camera(Point(0.0f, 0.0f, 0.0f));
+    vec2 mouseOffset(3.0f, 1.0f);
+
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(mouseOffset);
+        camera.look(mouseOffset);
+        benchmark::ClobberMemory();
+
+        // Moving the mouse back and forth keeps the pitch away from its limits
+        mouseOffset = -1.0f * mouseOffset;
+    }
+}
+
+BENCHMARK(cameraLook);
+
+BENCHMARK_MAIN();
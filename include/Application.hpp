@@ -7,15 +7,33 @@
 
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <stdexcept>
 #include <unordered_map>
 #include <vector>
 
 #include "Camera.hpp"
+#include "ConePrepass.hpp"
+#include "DynamicResolution.hpp"
+#include "FrameData.hpp"
+#include "GPUTimer.hpp"
+#include "Options.hpp"
+#include "SampleBuffer.hpp"
 #include "Shader.hpp"
+#include "ShaderCompiler.hpp"
+#include "ShaderWatcher.hpp"
+#include "StepHistogram.hpp"
+#include "UniformBuffer.hpp"
+#include "cpu/raymarching.hpp"
 #include "maths/vec2.hpp"
 
+constexpr unsigned int OVERLAY_FRAME_COUNT = 128u; ///< Frame times in the graph, see overlay.frag.
+constexpr unsigned int DEFAULT_SHADER_KEY = SCENE_COUNT; ///< Compiler key of the default shader.
+constexpr unsigned int PREPASS_SHADER_KEY = SCENE_COUNT + 1u; ///< Compiler key of the prepass.
+constexpr unsigned int SHADER_KEY_COUNT = SCENE_COUNT + 2u;   ///< The number of compiler keys.
+
 /**
  * @class Application
  * @brief The core of the engine.
@@ -25,9 +43,11 @@ public:
     /**** Constructor & Destructor ****/
 
     /**
-     * @brief Sets the default value of all member variables and constants.
+     * @brief Sets the default value of all member variables and constants. Creates the window
+     * unless the application runs headless.
+     * @param options The settings chosen on the command line.
      */
-    Application();
+    Application(const Options& options);
 
     /**
      * @brief Frees all allocated memory.
@@ -37,7 +57,7 @@ public:
     /**** Public Methods ****/
 
     /**
-     * @brief Contains the main loop.
+     * @brief Contains the main loop, or renders the requested frames to files in headless mode.
      */
     void run();
 
@@ -77,14 +97,168 @@ private:
     void handleKeyboardEvents();
 
     /**
-     * @brief Initializes the shader and its uniforms.
+     * @brief Initializes the default shader, the prepass shader and their uniforms.
      */
     void initShader();
 
+    /**
+     * @brief Gets the shader program compiled under a key.
+     * @param key The key, a scene, DEFAULT_SHADER_KEY or PREPASS_SHADER_KEY.
+     * @return A reference to the program, which is nullptr until it is ready.
+     */
+    Shader*& getShader(unsigned int key);
+
+    /**
+     * @brief Uses a shader program and sets the uniforms that only change on key presses. Also
+     * looks up the location of the uniforms set every frame, since this is called whenever a
+     * program is created or replaced.
+     * @param key The key of the program, a scene, DEFAULT_SHADER_KEY or PREPASS_SHADER_KEY.
+     */
+    void setShaderUniforms(unsigned int key);
+
+    /**
+     * @brief Sets the uniforms that only change on key presses in every loaded shader program.
+     */
+    void setAllShaderUniforms();
+
+    /**
+     * @brief Queues the compilation of shader programs in the background, the current scene's
+     * first. Requests that were still pending are dropped. The programs in use are only replaced
+     * once their new version is ready.
+     * @param isRequested Whether to compile each program, indexed by scene then with the default
+     * shader at DEFAULT_SHADER_KEY and the prepass shader at PREPASS_SHADER_KEY.
+     */
+    void requestShaders(const std::vector<bool>& isRequested);
+
+    /**
+     * @brief Takes ownership of the shader programs the shader compiler finished.
+     */
+    void collectShaders();
+
+    /**
+     * @brief Recompiles the shader programs made from files that were modified since the last
+     * call, along with the ones that were pending since they may have read the files before.
+     */
+    void watchShaders();
+
+    /**
+     * @brief Gets the program to draw the current scene with.
+     * @return The program specialized for the current scene if it is ready, the default shader
+     * otherwise.
+     */
+    Shader* getSceneShader() const;
+
+    /**
+     * @brief Gets the key of the program to draw the current scene with, see getSceneShader.
+     * @return The current scene if its specialized program is ready, DEFAULT_SHADER_KEY otherwise.
+     */
+    unsigned int getSceneShaderKey() const;
+
+    /**
+     * @brief Gets the anti-aliasing the current scene is drawn with.
+     * @return The chosen anti-aliasing, except for the temporal one in animated scenes, which falls
+     * back to the adaptive one.
+     */
+    AntiAliasing getAntiAliasing() const;
+
+    /**
+     * @brief Fills both history buffers of the temporal accumulation with zeros, so the next
+     * frames don't accumulate samples drawn with other settings.
+     */
+    void clearHistory();
+
+    /**
+     * @brief Chooses the resolution the scene is rendered at from the window's size and the scale
+     * of the dynamic resolution, and resizes the render targets to it.
+     */
+    void updateRenderSize();
+
+    /**
+     * @brief Writes the values that change every frame to the uniform buffer with a single copy and
+     * uses the current scene's shader.
+     */
+    void setFrameUniforms();
+
+    /**
+     * @brief Draws the current scene, after the cone marching prepass if it is enabled. With the
+     * adaptive anti-aliasing, one sample per pixel is rendered to the sample buffer first and only
+     * the pixels on its edges are supersampled. With the temporal accumulation, the new samples
+     * are blended with the previous history buffer into the other one, which is then shown and
+     * becomes the previous one. With dynamic resolution, the scene is drawn to the render target
+     * at the render size and upsampled to the window. The frame's uniforms must have been set.
+     */
+    void drawScene();
+
+    /**
+     * @brief Reads the step histogram of the last frame drawn with a debug view back and prints it.
+     */
+    void printStepHistogram();
+
+    /**
+     * @brief Reads the GPU frame times that became available, logs them with the scale of their
+     * frame, gives them to the dynamic resolution and updates the window's title with their average
+     * about twice per second.
+     */
+    void readGPUTimings();
+
+    /**
+     * @brief Draws the graph of the last GPU frame times in the bottom left corner of the window.
+     */
+    void drawOverlay();
+
+    /**
+     * @brief Gathers the values of the uniforms for the CPU renderer.
+     * @return The uniforms of the current frame.
+     */
+    Uniforms getUniforms() const;
+
+    /**
+     * @brief Renders the frames requested on the command line with the CPU renderer and writes
+     * them to image files. No window or OpenGL context is needed.
+     */
+    void renderOffline();
+
+    /**
+     * @brief Calculates the path of a frame rendered in headless mode. When several frames are
+     * rendered, the zero-padded frame number is appended to the requested file name.
+     * @param frame The index of the frame.
+     * @return The path of the image file.
+     */
+    std::filesystem::path getFramePath(unsigned int frame) const;
+
+    /**
+     * @brief Renders every scene while the camera orbits its target, then prints frame time
+     * statistics and writes them to a JSON file. Uses the CPU renderer in headless mode and the
+     * GPU otherwise, in which case vsync is disabled and each frame is waited for with glFinish.
+     */
+    void runBenchmark();
+
+    /**
+     * @brief Counts the steps of one ray per pixel in every scene with plain and over-relaxed
+     * sphere tracing on the CPU, from the initial camera pose, and prints the comparison.
+     */
+    void compareSteps();
+
+    /**
+     * @struct OverlayLocations
+     * @brief The locations of the uniforms of the overlay shader, which are set every frame.
+     */
+    struct OverlayLocations {
+        int origin;     ///< The location of origin.
+        int size;       ///< The location of size.
+        int maxTime;    ///< The location of maxTime.
+        int frameTimes; ///< The location of frameTimes.
+        int latest;     ///< The location of latest.
+    };
+
     /**** Variables & Constants ****/
+    Options options; ///< The settings chosen on the command line.
+
     GLFWwindow* window;  ///< GLFW window.
     unsigned int width;  ///< The width of the window in pixels.
     unsigned int height; ///< The height of the window in pixels.
+    unsigned int renderWidth;  ///< The width the scene is rendered at in pixels.
+    unsigned int renderHeight; ///< The height the scene is rendered at in pixels.
 
     std::unordered_map<int, bool> keys; ///< Map of the current state of keys.
 
@@ -95,10 +269,49 @@ private:
 
     bool cursorVisible; ///< Whether the cursor is currently visible.
 
-    Shader* shader; ///< The default shader program.
+    Shader* shader;                    ///< The default shader program, which handles every scene.
+    Shader* prepassShader;             ///< Writes the start distance of each tile of pixels.
+    std::vector<Shader*> sceneShaders; ///< Programs specialized per scene, nullptr until ready.
+    ShaderCompiler* shaderCompiler;    ///< Compiles the shader programs in the background.
+    std::vector<bool> pendingShaders;  ///< Which programs are being compiled, see requestShaders.
+    std::vector<int> renderPassLocations; ///< The location of renderPass in each program, by key.
+    ShaderWatcher* shaderWatcher;      ///< Reports the files modified in the shaders folder.
+    UniformBuffer* frameDataBuffer;    ///< Holds the FrameData block shared by the shaders.
+    ConePrepass* prepass;              ///< The render target of the cone marching prepass.
+    SampleBuffer* sampleBuffer;        ///< The samples the adaptive anti-aliasing finds edges in.
+    SampleBuffer* historyBuffer;       ///< Where the temporal accumulation writes this frame.
+    SampleBuffer* previousHistory;     ///< What the temporal accumulation wrote last frame.
+    SampleBuffer* renderTarget;        ///< Where the scene is drawn with dynamic resolution.
+    FrameData frameData;               ///< The values of the last frame, the next reprojects from.
+
+    GPUTimer* gpuTimer;     ///< Measures the GPU time of the ray-marching pass.
+    Shader* overlayShader;  ///< Draws the graph of the GPU frame times.
+    OverlayLocations overlayLocations; ///< Looked up once the overlay shader is created.
+    bool isOverlayVisible;  ///< Whether the graph of the GPU frame times is drawn.
+    unsigned int frame;     ///< The index of the current frame.
+    std::ofstream gpuLog;   ///< The CSV file GPU frame times are written to, if any.
+
+    std::vector<float> gpuFrameTimes; ///< The last GPU frame times in milliseconds, as a ring.
+    unsigned int latestGPUFrameTime;  ///< The index of the most recent GPU frame time.
+
+    float titleUpdateTime;           ///< The time the window's title was last updated at.
+    float gpuTimeSum;                ///< The sum of the GPU frame times since the last update.
+    unsigned int gpuTimeCount;       ///< The number of GPU frame times since the last update.
+
+    DynamicResolution dynamicResolution; ///< Chooses the render scale from the GPU frame times.
+    bool hasDynamicResolution;           ///< Whether the render scale follows dynamicResolution.
+    float renderScale;                   ///< The scale of the render size to the window's size.
+    std::vector<float> frameScales; ///< The render scale of the last frames, indexed by frame.
 
     Camera camera; ///< A first person camera to move around the scene.
 
     unsigned int scene; ///< The id of the current scene.
     bool hasLighting; ///< Whether the scene will calculate lighting.
+    bool isRelaxed;   ///< Whether rays are marched with over-relaxed sphere tracing.
+    bool isHitAdaptive; ///< Whether hits and step budgets adapt to the footprint and scene.
+    bool hasPrepass;  ///< Whether rays start from the distance found by the cone marching prepass.
+    NormalMethod normalMethod; ///< How the normals of the surfaces are estimated.
+    AntiAliasing antiAliasing; ///< How many samples are rendered per pixel.
+    DebugView debugView;          ///< What is drawn instead of the scene, if anything.
+    StepHistogram* stepHistogram; ///< Counts the pixels of each step count in debug views.
 };
\ No newline at end of file
@@ -0,0 +1,107 @@
+/***************************************************************************************************
+ * @file  Benchmark.hpp
+ * @brief Declaration of the frame-time statistics and reports of the benchmark mode
+ **************************************************************************************************/
+
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "maths/vec3.hpp"
+
+constexpr unsigned int BENCHMARK_WARMUP_FRAMES = 5u; ///< Frames rendered before measuring a scene.
+
+/**
+ * @struct FrameStatistics
+ * @brief Summarizes the frame times measured for a scene.
+ */
+struct FrameStatistics {
+    unsigned int scene;  ///< The id of the scene.
+    unsigned int frames; ///< The number of measured frames.
+
+    float min;    ///< The shortest frame time in milliseconds.
+    float median; ///< The median frame time in milliseconds.
+    float p95;    ///< The 95th percentile of the frame times in milliseconds.
+    float p99;    ///< The 99th percentile of the frame times in milliseconds.
+    float mean;   ///< The mean frame time in milliseconds.
+    float fps;    ///< The number of frames per second deduced from the mean frame time.
+};
+
+/**
+ * @struct BenchmarkReport
+ * @brief Holds everything needed to compare a benchmark run with another.
+ */
+struct BenchmarkReport {
+    std::string renderer; ///< The name of the device that rendered the frames.
+    unsigned int width;   ///< The width of the frames in pixels.
+    unsigned int height;  ///< The height of the frames in pixels.
+
+    std::vector<FrameStatistics> scenes; ///< The statistics of each scene.
+};
+
+/**
+ * @struct StepStatistics
+ * @brief Compares the number of steps rays take with plain and over-relaxed sphere tracing.
+ */
+struct StepStatistics {
+    unsigned int scene; ///< The id of the scene.
+    float relaxation;   ///< The over-relaxation factor of the scene.
+    float plainSteps;   ///< The mean number of steps per ray with plain sphere tracing.
+    float relaxedSteps; ///< The mean number of steps per ray with over-relaxed sphere tracing.
+};
+
+/**
+ * @brief Calculates the statistics of a series of frame times. Percentiles use the nearest-rank
+ * method.
+ * @param scene The id of the scene.
+ * @param frameTimes The frame times in milliseconds. Must not be empty.
+ * @return The statistics.
+ */
+FrameStatistics computeFrameStatistics(unsigned int scene, std::vector<float> frameTimes);
+
+/**
+ * @brief Calculates the position of the camera along the benchmark's path, which is a full turn
+ * around the target starting from the initial position.
+ * @param start The initial position of the camera.
+ * @param target The point the camera orbits around and looks at.
+ * @param frame The index of the frame.
+ * @param frameCount The number of frames of a full turn.
+ * @return The position of the camera.
+ */
+Point getBenchmarkCameraPosition(const Point& start, const Point& target,
+                                 unsigned int frame, unsigned int frameCount);
+
+/**
+ * @brief Writes a report as a human readable table.
+ * @param stream The output stream to write to.
+ * @param report The report.
+ */
+void writeBenchmarkTable(std::ostream& stream, const BenchmarkReport& report);
+
+/**
+ * @brief Writes the step counts of every scene as a human readable table, along with the reduction
+ * over-relaxation brings.
+ * @param stream The output stream to write to.
+ * @param scenes The step counts of each scene.
+ */
+void writeStepTable(std::ostream& stream, const std::vector<StepStatistics>& scenes);
+
+/**
+ * @brief Writes the step counts of the pixels of a frame drawn with a debug view as a human
+ * readable table, with the mean, percentiles and maximum of each pass. Step counts are only known
+ * to the nearest bin so percentiles and maximums are the upper bounds of their bins.
+ * @param stream The output stream to write to.
+ * @param scene The id of the scene.
+ * @param bins The bins read from the step histogram, see StepHistogram.
+ */
+void writeStepHistogram(std::ostream& stream, unsigned int scene,
+                        const std::vector<unsigned int>& bins);
+
+/**
+ * @brief Writes a report as JSON.
+ * @param stream The output stream to write to.
+ * @param report The report.
+ */
+void writeBenchmarkJSON(std::ostream& stream, const BenchmarkReport& report);
@@ -0,0 +1,134 @@
+/***************************************************************************************************
+ * @file  CPURenderer.hpp
+ * @brief Declaration of the CPURenderer class
+ **************************************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "cpu/raymarching.hpp"
+#include "cpu/simd.hpp"
+#include "maths/vec3.hpp"
+#include "maths/vec4.hpp"
+
+/**
+ * @class CPURenderer
+ * @brief Renders the scenes of shaders/maps.glsl on the CPU, without any GPU. The image is split
+ * into square tiles that worker threads pick up one after the other until none are left. The
+ * rays of each row of a tile are marched in packets, as many at a time as the CPU's registers hold.
+ */
+class CPURenderer {
+public:
+    /**
+     * @brief Allocates the image and sets the number of threads.
+     * @param width The width of the image in pixels.
+     * @param height The height of the image in pixels.
+     * @param threadCount The number of worker threads. 0 uses one thread per hardware thread.
+     * @param simdLevel The instruction set rays are marched with, which the CPU must support.
+     */
+    CPURenderer(unsigned int width, unsigned int height, unsigned int threadCount = 0,
+                SIMDLevel simdLevel = getSupportedSIMDLevel());
+
+    /**
+     * @brief Renders a frame. Blocks until every tile is done.
+     * @param uniforms The uniforms of the frame. The resolution is set to the image's.
+     */
+    void render(const Uniforms& uniforms);
+
+    /**
+     * @brief Marches one ray through the center of each pixel, without shading, and counts how
+     * many times the scene is evaluated. Nothing is written to the image.
+     * @param uniforms The uniforms of the frame. The resolution is set to the image's.
+     * @return The mean number of steps per ray.
+     */
+    float measureSteps(const Uniforms& uniforms);
+
+    /**
+     * @brief Getter for the width member.
+     * @return The width of the image in pixels.
+     */
+    unsigned int getWidth() const;
+
+    /**
+     * @brief Getter for the height member.
+     * @return The height of the image in pixels.
+     */
+    unsigned int getHeight() const;
+
+    /**
+     * @brief Getter for the threadCount member.
+     * @return The number of worker threads.
+     */
+    unsigned int getThreadCount() const;
+
+    /**
+     * @brief Getter for the simdLevel member.
+     * @return The instruction set rays are marched with.
+     */
+    SIMDLevel getSIMDLevel() const;
+
+    /**
+     * @brief Getter for the pixels member.
+     * @return The pixels of the last rendered frame, row by row from the top left corner.
+     */
+    const std::vector<Color>& getPixels() const;
+
+private:
+    /**
+     * @brief Runs a task on every tile, spread over the worker threads. Blocks until every tile is
+     * done.
+     * @param task The task, called with the index of the tile.
+     */
+    void forEachTile(const std::function<void(unsigned int)>& task);
+
+    /**
+     * @brief Renders pixels of a row with the packet marcher.
+     * @param indices The indices of the pixels in the image.
+     * @param sampleCount 1 for a sample at the center of each pixel, ANTI_ALIASING_SAMPLE_COUNT for
+     * the samples of renderAntiAliasing4, which are averaged.
+     * @param uniforms The uniforms of the frame.
+     * @param colors The image the colors are written to, at the pixels' indices.
+     * @param geometry The image the geometry of single samples is written to, if not nullptr.
+     */
+    void renderPixels(const std::vector<unsigned int>& indices, unsigned int sampleCount,
+                      const Uniforms& uniforms, Color* colors, vec4* geometry) const;
+
+    /**
+     * @brief Renders all the pixels of a tile.
+     * @param tile The index of the tile.
+     * @param uniforms The uniforms of the frame.
+     */
+    void renderTile(unsigned int tile, const Uniforms& uniforms);
+
+    /**
+     * @brief Renders one sample per pixel of a tile to the samples and geometry members, the
+     * first pass of the adaptive anti-aliasing.
+     * @param tile The index of the tile.
+     * @param uniforms The uniforms of the frame.
+     */
+    void sampleTile(unsigned int tile, const Uniforms& uniforms);
+
+    /**
+     * @brief Writes the pixels of a tile from the samples, supersampling the ones on edges. Every
+     * tile must have been sampled.
+     * @param tile The index of the tile.
+     * @param uniforms The uniforms of the frame.
+     */
+    void resolveTile(unsigned int tile, const Uniforms& uniforms);
+
+    static constexpr unsigned int TILE_SIZE = 32u; ///< The width and height of a tile in pixels.
+
+    unsigned int width;       ///< The width of the image in pixels.
+    unsigned int height;      ///< The height of the image in pixels.
+    unsigned int threadCount; ///< The number of worker threads.
+    SIMDLevel simdLevel;      ///< The instruction set rays are marched with.
+
+    unsigned int tilesX; ///< The number of tiles in a row.
+    unsigned int tilesY; ///< The number of tiles in a column.
+
+    std::vector<Color> pixels; ///< The rendered image.
+    std::vector<Color> samples; ///< One sample per pixel, for the adaptive anti-aliasing.
+    std::vector<vec4> geometry; ///< The normal and distance of each sample.
+};
@@ -35,6 +35,13 @@ public:
      */
     Camera(const Point& position);
 
+    /**
+     * @brief Constructs a camera at a given position looking at a given target.
+     * @param position The position of the camera.
+     * @param target The point the camera looks at.
+     */
+    Camera(const Point& position, const Point& target);
+
     /**
      * @brief Getter for the position member.
      * @return The position of the camera.
@@ -59,6 +66,13 @@ public:
      */
     Point getUp() const;
 
+    /**
+     * @brief Places the camera at a given position and points it towards a given target.
+     * @param position The new position of the camera.
+     * @param target The point the camera looks at.
+     */
+    void setPose(const Point& position, const Point& target);
+
     /**
      * @brief Moves the camera's position in the specified direction.
      * @param direction The direction of the movement.
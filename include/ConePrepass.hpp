@@ -0,0 +1,58 @@
+/***************************************************************************************************
+ * @file  ConePrepass.hpp
+ * @brief Declaration of the ConePrepass class
+ **************************************************************************************************/
+
+#pragma once
+
+constexpr unsigned int PREPASS_TILE_SIZE = 8u; ///< Pixels per side of a tile of the prepass.
+
+/**
+ * @class ConePrepass
+ * @brief The render target of the cone marching prepass. It holds one distance per tile of
+ * PREPASS_TILE_SIZE by PREPASS_TILE_SIZE pixels, from which every ray of the tile can start
+ * marching without stepping over a surface.
+ */
+class ConePrepass {
+public:
+    /**
+     * @brief Creates the texture and the framebuffer. Needs a current OpenGL context.
+     * @param width The width of the main pass in pixels.
+     * @param height The height of the main pass in pixels.
+     */
+    ConePrepass(unsigned int width, unsigned int height);
+
+    /**
+     * @brief Deletes the texture and the framebuffer.
+     */
+    ~ConePrepass();
+
+    /**
+     * @brief Reallocates the texture if the size of the main pass changed.
+     * @param width The width of the main pass in pixels.
+     * @param height The height of the main pass in pixels.
+     */
+    void resize(unsigned int width, unsigned int height);
+
+    /**
+     * @brief Binds the framebuffer and sets the viewport to the size of the texture.
+     */
+    void bindFramebuffer() const;
+
+    /**
+     * @brief Binds the texture to a texture unit.
+     * @param unit The index of the texture unit.
+     */
+    void bindTexture(unsigned int unit) const;
+
+private:
+    /**
+     * @brief Allocates the texture for the current size and attaches it to the framebuffer.
+     */
+    void allocate();
+
+    unsigned int framebuffer; ///< The framebuffer's id.
+    unsigned int texture;     ///< The texture's id, a single float channel.
+    unsigned int width;       ///< The width of the texture in tiles.
+    unsigned int height;      ///< The height of the texture in tiles.
+};
@@ -0,0 +1,53 @@
+/***************************************************************************************************
+ * @file  DynamicResolution.hpp
+ * @brief Declaration of the DynamicResolution class
+ **************************************************************************************************/
+
+#pragma once
+
+constexpr float DYNAMIC_RESOLUTION_MIN_SCALE = 0.25f; ///< The lowest scale of the resolution.
+constexpr float DYNAMIC_RESOLUTION_STEP = 0.05f;      ///< The scale changes by multiples of this.
+constexpr float DYNAMIC_RESOLUTION_SMOOTHING = 0.1f;  ///< Weight of a new time in the average.
+
+/**
+ * @class DynamicResolution
+ * @brief Chooses the scale of the rendering resolution from the GPU frame times so that frames
+ * take about a target time. The cost of a frame is assumed proportional to its number of pixels,
+ * so each measured time is converted to the time of a frame at full resolution. Their average then
+ * gives the largest scale that fits the target, rounded down to a step so the render targets are
+ * only reallocated when the cost changes noticeably.
+ */
+class DynamicResolution {
+public:
+    /**
+     * @brief Starts at full resolution.
+     * @param targetTime The frame time to reach, in milliseconds.
+     */
+    DynamicResolution(float targetTime);
+
+    /**
+     * @brief Takes a GPU frame time into account and updates the scale.
+     * @param time The GPU time of the frame in milliseconds.
+     * @param scale The scale the frame was rendered at, which may be older than the current one
+     * since the times are read back a few frames late.
+     */
+    void addFrameTime(float time, float scale);
+
+    /**
+     * @brief Getter for the scale member.
+     * @return The scale of the width and height of the rendering resolution, from
+     * DYNAMIC_RESOLUTION_MIN_SCALE to 1.
+     */
+    float getScale() const;
+
+    /**
+     * @brief Getter for the targetTime member.
+     * @return The frame time to reach, in milliseconds.
+     */
+    float getTargetTime() const;
+
+private:
+    float targetTime;    ///< The frame time to reach, in milliseconds.
+    float fullScaleTime; ///< The average time of a frame at full resolution, 0 before any frame.
+    float scale;         ///< The current scale.
+};
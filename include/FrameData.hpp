@@ -0,0 +1,55 @@
+/***************************************************************************************************
+ * @file  FrameData.hpp
+ * @brief Declaration of the FrameData struct
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+
+#include "maths/vec2.hpp"
+#include "maths/vec3.hpp"
+
+constexpr unsigned int FRAME_DATA_BINDING = 0u; ///< The binding point of the FrameData block.
+
+/**
+ * @struct FrameData
+ * @brief The values that change every frame, laid out like the std140 FrameData uniform block of
+ * default.frag. vec3s are aligned on 16 bytes in std140 so each is followed by a float, either a
+ * value or padding.
+ */
+struct FrameData {
+    vec3 cameraPos;           ///< The position of the camera.
+    float time;               ///< The time in seconds.
+    vec3 cameraFront;         ///< The direction the camera looks at.
+    float padding0;           ///< Unused.
+    vec3 cameraRight;         ///< The right vector of the camera.
+    float padding1;           ///< Unused.
+    vec3 cameraUp;            ///< The up vector of the camera.
+    float padding2;           ///< Unused.
+    vec2 resolution;          ///< The size of the framebuffer in pixels.
+    unsigned int frame;       ///< The index of the frame, which picks the accumulated sample.
+    float padding3;           ///< Unused.
+
+    vec3 previousCameraPos;   ///< The position of the camera in the previous frame.
+    float padding4;           ///< Unused.
+    vec3 previousCameraFront; ///< The direction the camera looked at in the previous frame.
+    float padding5;           ///< Unused.
+    vec3 previousCameraRight; ///< The right vector of the camera in the previous frame.
+    float padding6;           ///< Unused.
+    vec3 previousCameraUp;    ///< The up vector of the camera in the previous frame.
+    float padding7;           ///< Unused, std140 rounds the block's size up to 16 bytes.
+};
+
+static_assert(offsetof(FrameData, cameraPos) == 0);
+static_assert(offsetof(FrameData, time) == 12);
+static_assert(offsetof(FrameData, cameraFront) == 16);
+static_assert(offsetof(FrameData, cameraRight) == 32);
+static_assert(offsetof(FrameData, cameraUp) == 48);
+static_assert(offsetof(FrameData, resolution) == 64);
+static_assert(offsetof(FrameData, frame) == 72);
+static_assert(offsetof(FrameData, previousCameraPos) == 80);
+static_assert(offsetof(FrameData, previousCameraFront) == 96);
+static_assert(offsetof(FrameData, previousCameraRight) == 112);
+static_assert(offsetof(FrameData, previousCameraUp) == 128);
+static_assert(sizeof(FrameData) == 144);
@@ -0,0 +1,63 @@
+/***************************************************************************************************
+ * @file  GPUTimer.hpp
+ * @brief Declaration of the GPUTimer class
+ **************************************************************************************************/
+
+#pragma once
+
+constexpr unsigned int GPU_TIMER_QUERY_COUNT = 4u; ///< The number of queries in flight at most.
+
+/**
+ * @struct GPUTiming
+ * @brief The time the GPU spent on the commands of a frame.
+ */
+struct GPUTiming {
+    unsigned int frame; ///< The index of the frame the time was measured on.
+    float time;         ///< The elapsed GPU time in milliseconds.
+};
+
+/**
+ * @class GPUTimer
+ * @brief Measures the time the GPU spends on commands with a ring of GL_TIME_ELAPSED queries.
+ * Results are only read once the GPU made them available, which is usually a few frames later, so
+ * measuring never stalls the pipeline. When every query of the ring is still in flight, the frame
+ * is not measured.
+ */
+class GPUTimer {
+public:
+    /**
+     * @brief Creates the queries. Needs a current OpenGL context.
+     */
+    GPUTimer();
+
+    /**
+     * @brief Deletes the queries.
+     */
+    ~GPUTimer();
+
+    /**
+     * @brief Starts measuring the commands issued until end() is called.
+     * @param frame The index of the frame, returned with the result.
+     */
+    void begin(unsigned int frame);
+
+    /**
+     * @brief Stops measuring.
+     */
+    void end();
+
+    /**
+     * @brief Gets the oldest result the GPU has made available, without waiting.
+     * @param timing The result, only written to when there is one.
+     * @return Whether a result was available.
+     */
+    bool getResult(GPUTiming& timing);
+
+private:
+    unsigned int queries[GPU_TIMER_QUERY_COUNT]; ///< The ids of the queries.
+    unsigned int frames[GPU_TIMER_QUERY_COUNT];  ///< The frame each query measures.
+
+    unsigned int first;   ///< The index of the oldest pending query.
+    unsigned int pending; ///< The number of queries waiting for their result.
+    bool isMeasuring;     ///< Whether a query was started and not ended yet.
+};
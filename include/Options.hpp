@@ -0,0 +1,73 @@
+/***************************************************************************************************
+ * @file  Options.hpp
+ * @brief Declaration of the Options struct and of the command line parsing
+ **************************************************************************************************/
+
+#pragma once
+
+#include <ostream>
+#include <string>
+
+#include "cpu/raymarching.hpp"
+#include "cpu/simd.hpp"
+#include "maths/vec3.hpp"
+
+/**
+ * @struct Options
+ * @brief The settings of the application that can be chosen on the command line.
+ */
+struct Options {
+    /**
+     * @brief Sets the default value of every option.
+     */
+    Options();
+
+    bool help;     ///< Whether the usage was requested.
+    bool headless; ///< Whether to render frames to files on the CPU instead of opening a window.
+
+    unsigned int width;  ///< The width of the window or of the rendered images in pixels.
+    unsigned int height; ///< The height of the window or of the rendered images in pixels.
+
+    unsigned int scene; ///< The id of the first scene.
+    bool hasLighting;   ///< Whether the scene will calculate lighting.
+    bool isRelaxed;     ///< Whether rays are marched with over-relaxed sphere tracing.
+    bool isHitAdaptive; ///< Whether hits and step budgets adapt to the footprint and scene.
+    bool hasPrepass;    ///< Whether rays start from the distance found by a cone marching prepass.
+    NormalMethod normalMethod; ///< How the normals of the surfaces are estimated.
+    AntiAliasing antiAliasing; ///< How many samples are rendered per pixel.
+
+    Point cameraPos;    ///< The initial position of the camera.
+    Point cameraTarget; ///< The point the camera initially looks at.
+
+    unsigned int frames;  ///< The number of frames to render in headless mode.
+    float time;           ///< The time of the first frame in headless mode, in seconds.
+    float timeStep;       ///< The time between two frames in headless mode, in seconds.
+    unsigned int threads; ///< The number of threads used in headless mode. 0 uses all of them.
+    SIMDLevel simd;       ///< The instruction set rays are marched with on the CPU.
+    std::string output;   ///< The path of the rendered images. The extension sets the format.
+
+    bool benchmark;               ///< Whether to measure the frame times of every scene and exit.
+    unsigned int benchmarkFrames; ///< The number of measured frames per scene.
+    std::string benchmarkOutput;  ///< The path of the JSON report of the benchmark.
+    bool compareSteps;            ///< Whether to compare the steps of plain and relaxed marching.
+
+    std::string gpuLog; ///< The path of the CSV file GPU frame times are logged to, empty for none.
+
+    bool dynamicResolution; ///< Whether the resolution is scaled to reach the target frame time.
+    float targetFrameTime;  ///< The GPU frame time dynamic resolution aims for, in milliseconds.
+};
+
+/**
+ * @brief Parses the command line arguments.
+ * @param argc The number of arguments.
+ * @param argv The arguments, the first one being the program's name.
+ * @return The parsed options.
+ */
+Options parseOptions(int argc, char* argv[]);
+
+/**
+ * @brief Writes the list of available options to a stream.
+ * @param stream The output stream to write to.
+ * @param program The name of the program.
+ */
+void printUsage(std::ostream& stream, const std::string& program);
@@ -0,0 +1,81 @@
+/***************************************************************************************************
+ * @file  SampleBuffer.hpp
+ * @brief Declaration of the SampleBuffer class
+ **************************************************************************************************/
+
+#pragma once
+
+/**
+ * @enum RenderPass
+ * @brief The passes of the adaptive anti-aliasing. Must match the RENDER_PASS constants of
+ * shaders/anti_aliasing.glsl.
+ */
+enum class RenderPass : unsigned int {
+    samples, ///< Renders one sample per pixel to the sample buffer.
+    resolve  ///< Draws the samples, supersampling the pixels on edges.
+};
+
+/**
+ * @class SampleBuffer
+ * @brief A render target holding a color and a geometry per pixel. The first pass of the adaptive
+ * anti-aliasing writes one sample per pixel to it, from which the second pass finds the edges, and
+ * the temporal accumulation keeps its history in two of them.
+ */
+class SampleBuffer {
+public:
+    /**
+     * @brief Creates the textures and the framebuffer. Needs a current OpenGL context.
+     * @param width The width of the textures in pixels.
+     * @param height The height of the textures in pixels.
+     */
+    SampleBuffer(unsigned int width, unsigned int height);
+
+    /**
+     * @brief Deletes the textures and the framebuffer.
+     */
+    ~SampleBuffer();
+
+    /**
+     * @brief Reallocates the textures if the size changed.
+     * @param width The new width in pixels.
+     * @param height The new height in pixels.
+     */
+    void resize(unsigned int width, unsigned int height);
+
+    /**
+     * @brief Binds the framebuffer and sets the viewport to the size of the textures.
+     */
+    void bindFramebuffer() const;
+
+    /**
+     * @brief Fills both textures with zeros.
+     */
+    void clear() const;
+
+    /**
+     * @brief Copies the colors to the default framebuffer, which is left bound. They are filtered
+     * linearly when the sizes differ.
+     * @param width The width of the default framebuffer in pixels.
+     * @param height The height of the default framebuffer in pixels.
+     */
+    void blitColors(int width, int height) const;
+
+    /**
+     * @brief Binds the textures to two texture units.
+     * @param colorUnit The index of the texture unit of the colors.
+     * @param geometryUnit The index of the texture unit of the geometry.
+     */
+    void bindTextures(unsigned int colorUnit, unsigned int geometryUnit) const;
+
+private:
+    /**
+     * @brief Allocates the textures for the current size and attaches them to the framebuffer.
+     */
+    void allocate();
+
+    unsigned int framebuffer; ///< The framebuffer's id.
+    unsigned int colors;      ///< The texture of the colors, filtered linearly.
+    unsigned int geometry;    ///< The texture of the normals in rgb and distances in alpha.
+    unsigned int width;       ///< The width of the textures in pixels.
+    unsigned int height;      ///< The height of the textures in pixels.
+};
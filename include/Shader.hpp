@@ -5,36 +5,62 @@
 
 #pragma once
 
+#include <cstdint>
 #include <filesystem>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
+#include "ShaderPreprocessor.hpp"
 #include "maths/vec2.hpp"
 #include "maths/vec3.hpp"
 #include "maths/vec4.hpp"
 #include "maths/Matrix4.hpp"
 
+constexpr const char* PROGRAM_CACHE_DIRECTORY = "cache/shaders"; ///< Where binaries are stored.
+
 /**
- * @brief Preprocesses a shader. This actually reads '#include' directives in the glsl code and
- * appends the corresponding files in place of the directives.
- * @param path The shader's path.
- * @return The preprocessed source code.
+ * @brief Calculates the path of the cached binary of a program. The name is a hash of the paths of
+ * its shaders and of its defines, so each program has a single binary that is overwritten when its
+ * sources change.
+ * @param vertexShaderPath The path to the vertex shader.
+ * @param fragmentShaderPath The path to the fragment shader.
+ * @param defines The macros defined in the fragment shader.
+ * @return The path of the binary in the cache directory.
  */
-std::string preprocessShader(const std::filesystem::path& path);
+std::filesystem::path getProgramBinaryPath(const std::string& vertexShaderPath,
+                                           const std::string& fragmentShaderPath,
+                                           const std::vector<std::string>& defines);
+
+/**
+ * @brief Hashes the sources of a program and the current OpenGL driver. The hash is stored in the
+ * cached binary, so editing a shader or updating the driver misses the cache. Needs a current
+ * OpenGL context.
+ * @param vertexShaderCode The preprocessed source code of the vertex shader.
+ * @param fragmentShaderCode The preprocessed source code of the fragment shader.
+ * @return The hash.
+ */
+uint64_t getProgramSourceHash(const std::string& vertexShaderCode,
+                              const std::string& fragmentShaderCode);
 
 /**
  * @class Shader
  * @brief Compiles, links and creates a shader program that can be then be bound. Can set the value
- * of uniforms in the shader program.
+ * of uniforms in the shader program. Linked programs are cached on disk as binaries that are loaded
+ * instead of compiling the same sources again.
  */
 class Shader {
 public:
     /**
-     * @brief Compiles then links and creates the shader program from the vertex and fragment
-     * shaders located at the given paths.
+     * @brief Loads the cached binary of the shader program made from the vertex and fragment
+     * shaders located at the given paths, or compiles then links and caches it if there is none.
      * @param vertexShaderPath The path to the vertex shader.
      * @param fragmentShaderPath The path to the fragment shader.
+     * @param defines Macros defined in the fragment shader, as "NAME" or "NAME value".
      */
-    Shader(const std::string& vertexShaderPath, const std::string& fragmentShaderPath);
+    Shader(const std::string& vertexShaderPath, const std::string& fragmentShaderPath,
+           const std::vector<std::string>& defines = {});
 
     /**
      * @brief Deletes the shader program.
@@ -46,33 +72,49 @@ public:
      */
     void use();
 
+    /**
+     * @brief Whether a file is part of the shader program's sources, directly or through an
+     * include.
+     * @param file The path of the file, relative to the same folder as the shaders' paths.
+     * @return Whether the file contributed to the shader program.
+     */
+    bool isMadeOf(const std::filesystem::path& file) const;
+
+    /**
+     * @brief Gets the location of a uniform from the cache filled when the program was linked. The
+     * location can be given to the setters and getters taking one, which skip the lookup entirely.
+     * @param uniform The uniform's name.
+     * @return The uniform's location, or -1 if the program has no such active uniform.
+     */
+    int getUniformLocation(std::string_view uniform) const;
+
     /**
      * @brief Sets the value of a uniform of type int.
      * @param uniform The uniform's name.
      * @param value The new value of the uniform.
      */
-    void setUniform(const std::string& uniform, int value) const;
+    void setUniform(std::string_view uniform, int value) const;
 
     /**
      * @brief Sets the value of a uniform of type unsigned int.
      * @param uniform The uniform's name.
      * @param value The new value of the uniform.
      */
-    void setUniform(const std::string& uniform, unsigned int value) const;
+    void setUniform(std::string_view uniform, unsigned int value) const;
 
     /**
      * @brief Sets the value of a uniform of type bool.
      * @param uniform The uniform's name.
      * @param value The new value of the uniform.
      */
-    void setUniform(const std::string& uniform, bool value) const;
+    void setUniform(std::string_view uniform, bool value) const;
 
     /**
      * @brief Sets the value of a uniform of type float.
      * @param uniform The uniform's name.
      * @param value The new value of the uniform.
      */
-    void setUniform(const std::string& uniform, float value) const;
+    void setUniform(std::string_view uniform, float value) const;
 
     /**
      * @brief Sets the value of a uniform of type vec2.
@@ -80,7 +122,7 @@ public:
      * @param x The new x value of the uniform.
      * @param y The new y value of the uniform.
      */
-    void setUniform(const std::string& uniform, float x, float y) const;
+    void setUniform(std::string_view uniform, float x, float y) const;
 
     /**
      * @brief Sets the value of a uniform of type vec3.
@@ -89,7 +131,7 @@ public:
      * @param y The new y value of the uniform.
      * @param z The new z value of the uniform.
      */
-    void setUniform(const std::string& uniform, float x, float y, float z) const;
+    void setUniform(std::string_view uniform, float x, float y, float z) const;
 
     /**
      * @brief Sets the value of a uniform of type vec4.
@@ -99,92 +141,291 @@ public:
      * @param z The new z value of the uniform.
      * @param w The new w value of the uniform.
      */
-    void setUniform(const std::string& uniform, float x, float y, float z, float w) const;
+    void setUniform(std::string_view uniform, float x, float y, float z, float w) const;
 
     /**
      * @brief Sets the value of a uniform of type vec2.
      * @param uniform The uniform's name.
      * @param vec The new value of the uniform.
      */
-    void setUniform(const std::string& uniform, const vec2& vec) const;
+    void setUniform(std::string_view uniform, const vec2& vec) const;
 
     /**
      * @brief Sets the value of a uniform of type vec3.
      * @param uniform The uniform's name.
      * @param vec The new value of the uniform.
      */
-    void setUniform(const std::string& uniform, const vec3& vec) const;
+    void setUniform(std::string_view uniform, const vec3& vec) const;
 
     /**
      * @brief Sets the value of a uniform of type vec4.
      * @param uniform The uniform's name.
      * @param vec The new value of the uniform.
      */
-    void setUniform(const std::string& uniform, const vec4& vec) const;
+    void setUniform(std::string_view uniform, const vec4& vec) const;
+
+    /**
+     * @brief Sets the values of a uniform of type float[].
+     * @param uniform The uniform's name.
+     * @param values The new values of the uniform's elements, starting from the first one.
+     */
+    void setUniform(std::string_view uniform, const std::vector<float>& values) const;
 
     /**
      * @brief Sets the value of a uniform of type mat4.
      * @param uniform The uniform's name.
      * @param matrix The new value of the uniform.
      */
-    void setUniform(const std::string& uniform, const Matrix4& matrix) const;
+    void setUniform(std::string_view uniform, const Matrix4& matrix) const;
 
     /**
      * @brief Gets the value of a uniform of type int.
      * @param uniform The uniform's name.
      * @param value The value of the uniform.
      */
-    void getUniform(const std::string& uniform, int& value) const;
+    void getUniform(std::string_view uniform, int& value) const;
 
     /**
      * @brief Gets the value of a uniform of type unsigned int.
      * @param uniform The uniform's name.
      * @param value The value of the uniform.
      */
-    void getUniform(const std::string& uniform, unsigned int& value) const;
+    void getUniform(std::string_view uniform, unsigned int& value) const;
 
     /**
      * @brief Gets the value of a uniform of type bool.
      * @param uniform The uniform's name.
      * @param value The value of the uniform.
      */
-    void getUniform(const std::string& uniform, bool& value) const;
+    void getUniform(std::string_view uniform, bool& value) const;
 
     /**
      * @brief Gets the value of a uniform of type float.
      * @param uniform The uniform's name.
      * @param value The value of the uniform.
      */
-    void getUniform(const std::string& uniform, float& value) const;
+    void getUniform(std::string_view uniform, float& value) const;
 
     /**
      * @brief Gets the value of a uniform of type vec2.
      * @param uniform The uniform's name.
      * @param vec The value of the uniform.
      */
-    void getUniform(const std::string& uniform, vec2& vec) const;
+    void getUniform(std::string_view uniform, vec2& vec) const;
 
     /**
      * @brief Gets the value of a uniform of type vec3.
      * @param uniform The uniform's name.
      * @param vec The value of the uniform.
      */
-    void getUniform(const std::string& uniform, vec3& vec) const;
+    void getUniform(std::string_view uniform, vec3& vec) const;
 
     /**
      * @brief Gets the value of a uniform of type vec4.
      * @param uniform The uniform's name.
      * @param vec The value of the uniform.
      */
-    void getUniform(const std::string& uniform, vec4& vec) const;
+    void getUniform(std::string_view uniform, vec4& vec) const;
 
     /**
      * @brief Gets the value of a uniform of type mat4.
      * @param uniform The uniform's name.
      * @param matrix The value of the uniform.
      */
-    void getUniform(const std::string& uniform, Matrix4& matrix) const;
+    void getUniform(std::string_view uniform, Matrix4& matrix) const;
+
+    /**
+     * @brief Sets the value of a uniform of type int.
+     * @param location The uniform's location.
+     * @param value The new value of the uniform.
+     */
+    void setUniform(int location, int value) const;
+
+    /**
+     * @brief Sets the value of a uniform of type unsigned int.
+     * @param location The uniform's location.
+     * @param value The new value of the uniform.
+     */
+    void setUniform(int location, unsigned int value) const;
+
+    /**
+     * @brief Sets the value of a uniform of type bool.
+     * @param location The uniform's location.
+     * @param value The new value of the uniform.
+     */
+    void setUniform(int location, bool value) const;
+
+    /**
+     * @brief Sets the value of a uniform of type float.
+     * @param location The uniform's location.
+     * @param value The new value of the uniform.
+     */
+    void setUniform(int location, float value) const;
+
+    /**
+     * @brief Sets the value of a uniform of type vec2.
+     * @param location The uniform's location.
+     * @param x The new x value of the uniform.
+     * @param y The new y value of the uniform.
+     */
+    void setUniform(int location, float x, float y) const;
+
+    /**
+     * @brief Sets the value of a uniform of type vec3.
+     * @param location The uniform's location.
+     * @param x The new x value of the uniform.
+     * @param y The new y value of the uniform.
+     * @param z The new z value of the uniform.
+     */
+    void setUniform(int location, float x, float y, float z) const;
+
+    /**
+     * @brief Sets the value of a uniform of type vec4.
+     * @param location The uniform's location.
+     * @param x The new x value of the uniform.
+     * @param y The new y value of the uniform.
+     * @param z The new z value of the uniform.
+     * @param w The new w value of the uniform.
+     */
+    void setUniform(int location, float x, float y, float z, float w) const;
+
+    /**
+     * @brief Sets the value of a uniform of type vec2.
+     * @param location The uniform's location.
+     * @param vec The new value of the uniform.
+     */
+    void setUniform(int location, const vec2& vec) const;
+
+    /**
+     * @brief Sets the value of a uniform of type vec3.
+     * @param location The uniform's location.
+     * @param vec The new value of the uniform.
+     */
+    void setUniform(int location, const vec3& vec) const;
+
+    /**
+     * @brief Sets the value of a uniform of type vec4.
+     * @param location The uniform's location.
+     * @param vec The new value of the uniform.
+     */
+    void setUniform(int location, const vec4& vec) const;
+
+    /**
+     * @brief Sets the values of a uniform of type float[].
+     * @param location The uniform's location.
+     * @param values The new values of the uniform's elements, starting from the first one.
+     */
+    void setUniform(int location, const std::vector<float>& values) const;
+
+    /**
+     * @brief Sets the value of a uniform of type mat4.
+     * @param location The uniform's location.
+     * @param matrix The new value of the uniform.
+     */
+    void setUniform(int location, const Matrix4& matrix) const;
+
+    /**
+     * @brief Gets the value of a uniform of type int.
+     * @param location The uniform's location.
+     * @param value The value of the uniform.
+     */
+    void getUniform(int location, int& value) const;
+
+    /**
+     * @brief Gets the value of a uniform of type unsigned int.
+     * @param location The uniform's location.
+     * @param value The value of the uniform.
+     */
+    void getUniform(int location, unsigned int& value) const;
+
+    /**
+     * @brief Gets the value of a uniform of type bool.
+     * @param location The uniform's location.
+     * @param value The value of the uniform.
+     */
+    void getUniform(int location, bool& value) const;
+
+    /**
+     * @brief Gets the value of a uniform of type float.
+     * @param location The uniform's location.
+     * @param value The value of the uniform.
+     */
+    void getUniform(int location, float& value) const;
+
+    /**
+     * @brief Gets the value of a uniform of type vec2.
+     * @param location The uniform's location.
+     * @param vec The value of the uniform.
+     */
+    void getUniform(int location, vec2& vec) const;
+
+    /**
+     * @brief Gets the value of a uniform of type vec3.
+     * @param location The uniform's location.
+     * @param vec The value of the uniform.
+     */
+    void getUniform(int location, vec3& vec) const;
+
+    /**
+     * @brief Gets the value of a uniform of type vec4.
+     * @param location The uniform's location.
+     * @param vec The value of the uniform.
+     */
+    void getUniform(int location, vec4& vec) const;
+
+    /**
+     * @brief Gets the value of a uniform of type mat4.
+     * @param location The uniform's location.
+     * @param matrix The value of the uniform.
+     */
+    void getUniform(int location, Matrix4& matrix) const;
 
 private:
+    /**
+     * @brief Compiles the shaders then links and creates the shader program.
+     * @param vertexShader The preprocessed vertex shader.
+     * @param fragmentShader The preprocessed fragment shader.
+     */
+    void compile(const ShaderSource& vertexShader, const ShaderSource& fragmentShader);
+
+    /**
+     * @brief Creates the shader program from a cached binary.
+     * @param path The path of the binary.
+     * @param sourceHash The hash of the current sources, see getProgramSourceHash.
+     * @return Whether the binary existed, was made from the current sources and the driver
+     * accepted it.
+     */
+    bool loadProgramBinary(const std::filesystem::path& path, uint64_t sourceHash);
+
+    /**
+     * @brief Writes the binary of the shader program to the cache, replacing the previous one.
+     * Failing to do so is ignored.
+     * @param path The path of the binary.
+     * @param sourceHash The hash of the sources the program was made from.
+     */
+    void saveProgramBinary(const std::filesystem::path& path, uint64_t sourceHash) const;
+
+    /**
+     * @brief Fills the uniform location cache with every active uniform of the program.
+     */
+    void cacheUniformLocations();
+
+    /**
+     * @struct StringHash
+     * @brief Hashes strings and string views alike so the cache can be searched without building a
+     * std::string.
+     */
+    struct StringHash {
+        using is_transparent = void;
+
+        size_t operator()(std::string_view string) const {
+            return std::hash<std::string_view>{}(string);
+        }
+    };
+
     unsigned int id; ///< The shader program's id.
+
+    std::vector<std::filesystem::path> sourceFiles; ///< The files the program was made from.
+
+    std::unordered_map<std::string, int, StringHash, std::equal_to<>> uniformLocations; ///< Cache.
 };
\ No newline at end of file
@@ -0,0 +1,96 @@
+/***************************************************************************************************
+ * @file  ShaderCompiler.hpp
+ * @brief Declaration of the ShaderCompiler class
+ **************************************************************************************************/
+
+#pragma once
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Shader.hpp"
+
+/**
+ * @struct ShaderRequest
+ * @brief A shader program waiting to be compiled.
+ */
+struct ShaderRequest {
+    unsigned int key;                 ///< Identifies the program, returned with the result.
+    std::string vertexShaderPath;     ///< The path to the vertex shader.
+    std::string fragmentShaderPath;   ///< The path to the fragment shader.
+    std::vector<std::string> defines; ///< The macros defined in the fragment shader.
+};
+
+/**
+ * @struct CompiledShader
+ * @brief A shader program compiled by the ShaderCompiler.
+ */
+struct CompiledShader {
+    unsigned int key;  ///< The key of the request.
+    Shader* shader;    ///< The program, owned by the receiver. nullptr if compiling failed.
+    std::string error; ///< Why compiling failed, empty if it didn't.
+};
+
+/**
+ * @class ShaderCompiler
+ * @brief Compiles shader programs on a worker thread with its own OpenGL context, which shares its
+ * objects with the window's context. The render loop keeps drawing while the driver compiles and
+ * collects the programs once they are ready.
+ */
+class ShaderCompiler {
+public:
+    /**
+     * @brief Creates the worker's hidden window and starts the worker. Must be called from the
+     * main thread.
+     * @param window The window whose context the programs are used in.
+     */
+    ShaderCompiler(GLFWwindow* window);
+
+    /**
+     * @brief Stops the worker, deletes the programs nobody collected and destroys the worker's
+     * window. Must be called from the main thread with the window's context current.
+     */
+    ~ShaderCompiler();
+
+    /**
+     * @brief Queues a program. Requests are compiled in the order they were made.
+     * @param request The program to compile.
+     */
+    void request(const ShaderRequest& request);
+
+    /**
+     * @brief Drops every queued request and discards the result of the one being compiled, for
+     * instance because the sources changed since they were made.
+     */
+    void clear();
+
+    /**
+     * @brief Gets the oldest compiled program, without waiting.
+     * @param result The program, only written to when there is one.
+     * @return Whether a program was available.
+     */
+    bool getResult(CompiledShader& result);
+
+private:
+    /**
+     * @brief Compiles the queued requests until the compiler is destroyed.
+     */
+    void work();
+
+    GLFWwindow* context; ///< The hidden window holding the worker's context.
+
+    std::mutex mutex;                   ///< Guards every member below.
+    std::condition_variable condition;  ///< Notified when a request is queued or when stopping.
+    std::deque<ShaderRequest> requests; ///< The programs waiting to be compiled.
+    std::deque<CompiledShader> results; ///< The programs waiting to be collected.
+    unsigned int generation;            ///< Incremented by clear() to discard ongoing work.
+    bool isRunning;                     ///< Whether the worker should keep going.
+
+    std::thread worker; ///< The thread compiling the programs.
+};
@@ -0,0 +1,45 @@
+/***************************************************************************************************
+ * @file  ShaderPreprocessor.hpp
+ * @brief Declaration of the shader preprocessor
+ **************************************************************************************************/
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+/**
+ * @struct ShaderSource
+ * @brief The result of preprocessing a shader.
+ */
+struct ShaderSource {
+    std::string code; ///< The preprocessed source code.
+
+    /**
+     * @brief The files the code is made of. The index of a file is the source string number used
+     * in the '#line' directives, so compiler messages can be traced back to it.
+     */
+    std::vector<std::filesystem::path> files;
+};
+
+/**
+ * @brief Preprocesses a shader. This actually reads '#include' directives in the glsl code and
+ * appends the corresponding files in place of the directives. Files are only read again when they
+ * were modified since they were last read, and the ones containing '#pragma once' or guarded by an
+ * '#ifndef' '#define' pair are only appended the first time they are included. Each included file
+ * is surrounded by '#line' directives so line numbers refer to the actual files.
+ * @param path The shader's path.
+ * @param defines Macros defined right after the '#version' directive, as "NAME" or "NAME value".
+ * @return The preprocessed source code and the files it is made of.
+ */
+ShaderSource preprocessShader(const std::filesystem::path& path,
+                              const std::vector<std::string>& defines = {});
+
+/**
+ * @brief Lists which file each source string number of a preprocessed shader refers to, to be
+ * appended to compiler messages.
+ * @param source The preprocessed shader.
+ * @return One line per file with its source string number and its path.
+ */
+std::string getSourceStringNames(const ShaderSource& source);
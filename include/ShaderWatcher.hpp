@@ -0,0 +1,39 @@
+/***************************************************************************************************
+ * @file  ShaderWatcher.hpp
+ * @brief Declaration of the ShaderWatcher class
+ **************************************************************************************************/
+
+#pragma once
+
+#include <filesystem>
+#include <vector>
+
+/**
+ * @class ShaderWatcher
+ * @brief Watches a folder with inotify and reports the files written to it. Files saved by
+ * renaming a temporary file over them, as many editors do, are reported too.
+ */
+class ShaderWatcher {
+public:
+    /**
+     * @brief Starts watching a folder.
+     * @param directory The folder to watch. Its subfolders aren't watched.
+     */
+    ShaderWatcher(const std::filesystem::path& directory);
+
+    /**
+     * @brief Stops watching the folder.
+     */
+    ~ShaderWatcher();
+
+    /**
+     * @brief Gets the files modified since the last call, without waiting.
+     * @return The paths of the files, made of the watched folder's path and the files' names. Each
+     * file is only listed once.
+     */
+    std::vector<std::filesystem::path> getModifiedFiles();
+
+private:
+    std::filesystem::path directory; ///< The watched folder.
+    int descriptor;                  ///< The inotify instance's file descriptor.
+};
@@ -0,0 +1,62 @@
+/***************************************************************************************************
+ * @file  StepHistogram.hpp
+ * @brief Declaration of the StepHistogram class
+ **************************************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+constexpr unsigned int STEP_HISTOGRAM_BINDING = 1u;    ///< The binding point of the buffer.
+constexpr unsigned int STEP_HISTOGRAM_PASS_COUNT = 3u; ///< Marching, soft shadows and occlusion.
+constexpr unsigned int STEP_HISTOGRAM_BIN_COUNT = 64u; ///< The number of bins of each pass.
+constexpr unsigned int STEP_HISTOGRAM_BIN_SIZE = 4u;   ///< The number of step counts per bin.
+
+/**
+ * @enum DebugView
+ * @brief What default.frag draws instead of the scene. Must match the DEBUG_VIEW constants of
+ * shaders/debug.glsl.
+ */
+enum class DebugView : unsigned int {
+    none,      ///< The scene is drawn.
+    march,     ///< The steps of the ray through each pixel.
+    shadow,    ///< The steps of the soft shadow of each pixel.
+    occlusion, ///< The samples of the ambient occlusion of each pixel.
+    total      ///< Every evaluation of the scene for each pixel, normal included.
+};
+
+constexpr unsigned int DEBUG_VIEW_COUNT = 5u; ///< The number of values of DebugView.
+
+/**
+ * @class StepHistogram
+ * @brief A shader storage buffer in which debug views count the pixels of each step count, for
+ * each of the marching, soft shadow and ambient occlusion passes. It is laid out like the
+ * StepHistogram block of shaders/debug.glsl: the bins of each pass follow each other, the last bin
+ * of a pass also holding every larger step count.
+ */
+class StepHistogram {
+public:
+    /**
+     * @brief Creates the buffer, filled with zeros, and binds it. Needs a current OpenGL context.
+     */
+    StepHistogram();
+
+    /**
+     * @brief Deletes the buffer.
+     */
+    ~StepHistogram();
+
+    /**
+     * @brief Sets every bin to zero.
+     */
+    void clear();
+
+    /**
+     * @brief Reads the bins back, waiting for the GPU to finish writing them.
+     * @return STEP_HISTOGRAM_BIN_COUNT bins for each pass.
+     */
+    std::vector<unsigned int> read() const;
+
+private:
+    unsigned int id; ///< The buffer's id.
+};
@@ -0,0 +1,49 @@
+/***************************************************************************************************
+ * @file  UniformBuffer.hpp
+ * @brief Declaration of the UniformBuffer class
+ **************************************************************************************************/
+
+#pragma once
+
+#include <glad/glad.h>
+
+constexpr unsigned int UNIFORM_BUFFER_SECTION_COUNT = 3u; ///< The number of copies of the data.
+
+/**
+ * @class UniformBuffer
+ * @brief A uniform buffer that is mapped once for its whole lifetime and holds several copies of
+ * its data. Each write goes to the next copy, after waiting on a fence for the GPU to be done with
+ * it, so the CPU can prepare a frame while the GPU still reads the previous ones.
+ */
+class UniformBuffer {
+public:
+    /**
+     * @brief Creates the buffer and maps it. Needs a current OpenGL context.
+     * @param binding The binding point of the uniform block.
+     * @param size The size of the data in bytes.
+     */
+    UniformBuffer(unsigned int binding, unsigned int size);
+
+    /**
+     * @brief Unmaps and deletes the buffer.
+     */
+    ~UniformBuffer();
+
+    /**
+     * @brief Copies the data to the next copy of the buffer and binds it to the binding point.
+     * Commands issued before the call keep reading the previous copy.
+     * @param data The data, whose size is the one given to the constructor.
+     */
+    void write(const void* data);
+
+private:
+    unsigned int id;      ///< The buffer's id.
+    unsigned int binding; ///< The binding point of the uniform block.
+    unsigned int size;    ///< The size of the data in bytes.
+    unsigned int stride;  ///< The size of the data rounded up to the offset alignment.
+
+    unsigned char* mapping; ///< The address the buffer is mapped to.
+
+    GLsync fences[UNIFORM_BUFFER_SECTION_COUNT]; ///< Signaled once the GPU is done with a copy.
+    unsigned int section;                        ///< The index of the copy written last.
+};
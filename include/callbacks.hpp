@@ -7,7 +7,7 @@
 
 #include "Application.hpp"
 
-extern Application app;
+extern Application* app;
 
 /**
  * @brief Callback for when the specified window is resized.
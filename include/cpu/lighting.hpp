@@ -0,0 +1,63 @@
+/***************************************************************************************************
+ * @file  lighting.hpp
+ * @brief Declaration of the lighting functions of shaders/lighting.glsl
+ **************************************************************************************************/
+
+#pragma once
+
+#include "cpu/raymarching.hpp"
+#include "maths/vec3.hpp"
+
+/**
+ * @brief Estimates the normal of the active scene's surface using central differences along each
+ * axis, which takes 6 samples.
+ * @param pos The position on the surface.
+ * @param uniforms The uniforms of the current frame.
+ * @return The normalized normal.
+ */
+Vector getCentralNormal(const Point& pos, const Uniforms& uniforms);
+
+/**
+ * @brief Estimates the normal of the active scene's surface using differences along the vertices
+ * of a tetrahedron, which takes 4 samples. Their sum cancels out the distance at the position.
+ * @param pos The position on the surface.
+ * @param uniforms The uniforms of the current frame.
+ * @return The normalized normal.
+ */
+Vector getTetrahedralNormal(const Point& pos, const Uniforms& uniforms);
+
+/**
+ * @brief Estimates the normal of the active scene's surface with the method of the uniforms.
+ * @param pos The position on the surface.
+ * @param uniforms The uniforms of the current frame.
+ * @return The normalized normal.
+ */
+Vector getNormal(const Point& pos, const Uniforms& uniforms);
+
+/**
+ * @brief Marches towards the light to calculate a soft shadow factor.
+ * @param pos The position on the surface.
+ * @param uniforms The uniforms of the current frame.
+ * @return 0 if the position is fully shadowed, 1 if it is fully lit.
+ */
+float getSoftShadow(const Point& pos, const Uniforms& uniforms);
+
+/**
+ * @brief Samples the scene along the normal to approximate ambient occlusion.
+ * @param pos The position on the surface.
+ * @param normal The normal of the surface.
+ * @param uniforms The uniforms of the current frame.
+ * @return 0 if the position is fully occluded, 1 if it is not occluded at all.
+ */
+float getAmbientOcclusion(const Point& pos, const Vector& normal, const Uniforms& uniforms);
+
+/**
+ * @brief Calculates the lighting of a surface hit by a ray.
+ * @param ray The ray that hit the surface.
+ * @param pos The hit position.
+ * @param normal The normal of the surface at the hit position.
+ * @param uniforms The uniforms of the current frame.
+ * @return The light intensity to multiply the surface's color by.
+ */
+Color phongLighting(const Ray& ray, const Point& pos, const Vector& normal,
+                    const Uniforms& uniforms);
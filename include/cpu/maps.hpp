@@ -0,0 +1,92 @@
+/***************************************************************************************************
+ * @file  maps.hpp
+ * @brief Declaration of the raymarching scenes of shaders/maps.glsl
+ **************************************************************************************************/
+
+#pragma once
+
+#include "maths/vec3.hpp"
+#include "maths/vec4.hpp"
+
+/**
+ * @brief Evaluates a scene at a given position. Every mapN function mirrors its GLSL counterpart.
+ * @param pos The sampled position.
+ * @param time The current time in seconds.
+ * @return The color of the closest surface in the rgb components and its signed distance in w.
+ */
+vec4 map1(const Point& pos, float time);
+
+/** @copydoc map1 */
+vec4 map2(const Point& pos, float time);
+
+/** @copydoc map1 */
+vec4 map3(const Point& pos, float time);
+
+/** @copydoc map1 */
+vec4 map4(const Point& pos, float time);
+
+/** @copydoc map1 */
+vec4 map5(const Point& pos, float time);
+
+/** @copydoc map1 */
+vec4 map6(const Point& pos, float time);
+
+/** @copydoc map1 */
+vec4 map7(const Point& pos, float time);
+
+/** @copydoc map1 */
+vec4 map8(const Point& pos, float time);
+
+/** @copydoc map1 */
+vec4 map9(const Point& pos, float time);
+
+/** @copydoc map1 */
+vec4 map10(const Point& pos, float time);
+
+/** @copydoc map1 */
+vec4 map11(const Point& pos, float time);
+
+/** @copydoc map1 */
+vec4 map12(const Point& pos, float time);
+
+/**
+ * @brief Evaluates the distance to a scene at a given position, without its colors. Every
+ * mapNDistance function mirrors its GLSL counterpart and describes the same surfaces as mapN.
+ * @param pos The sampled position.
+ * @param time The current time in seconds.
+ * @return The signed distance to the closest surface.
+ */
+float map1Distance(const Point& pos, float time);
+
+/** @copydoc map1Distance */
+float map2Distance(const Point& pos, float time);
+
+/** @copydoc map1Distance */
+float map3Distance(const Point& pos, float time);
+
+/** @copydoc map1Distance */
+float map4Distance(const Point& pos, float time);
+
+/** @copydoc map1Distance */
+float map5Distance(const Point& pos, float time);
+
+/** @copydoc map1Distance */
+float map6Distance(const Point& pos, float time);
+
+/** @copydoc map1Distance */
+float map7Distance(const Point& pos, float time);
+
+/** @copydoc map1Distance */
+float map8Distance(const Point& pos, float time);
+
+/** @copydoc map1Distance */
+float map9Distance(const Point& pos, float time);
+
+/** @copydoc map1Distance */
+float map10Distance(const Point& pos, float time);
+
+/** @copydoc map1Distance */
+float map11Distance(const Point& pos, float time);
+
+/** @copydoc map1Distance */
+float map12Distance(const Point& pos, float time);
@@ -0,0 +1,168 @@
+/***************************************************************************************************
+ * @file  raymarching.hpp
+ * @brief Declaration of the raymarching functions of shaders/raymarching.glsl
+ **************************************************************************************************/
+
+#pragma once
+
+#include "maths/vec2.hpp"
+#include "maths/vec3.hpp"
+#include "maths/vec4.hpp"
+
+constexpr unsigned int MAX_STEPS = 256u;
+constexpr float MIN_DISTANCE = 0.001f;
+constexpr float MAX_DISTANCE = 500.0f;
+constexpr float HIT_FOOTPRINT = 0.5f; ///< Fraction of a pixel's footprint a hit must be closer than.
+
+constexpr unsigned int SCENE_COUNT = 12u; ///< The number of scenes in shaders/maps.glsl.
+
+/**
+ * @brief The over-relaxation factor of each scene, 1 for plain sphere tracing. Must match the
+ * RELAXATION array of shaders/raymarching.glsl.
+ */
+constexpr float RELAXATION[SCENE_COUNT] {
+    1.0f, 1.4f, 1.4f, 1.2f, 1.6f, 1.2f,
+    1.2f, 1.2f, 1.4f, 1.0f, 1.2f, 1.4f
+};
+
+/**
+ * @brief The maximum number of steps of a ray in each scene, measured with a margin over the rays
+ * that converge. Must match the STEP_BUDGET array of shaders/raymarching.glsl.
+ */
+constexpr unsigned int STEP_BUDGET[SCENE_COUNT] {
+    256u, 256u, 192u, 96u, 128u, 96u,
+    256u, 64u, 192u, 96u, 160u, 64u
+};
+
+/**
+ * @brief Whether each scene depends on time. The temporal accumulation falls back to the adaptive
+ * anti-aliasing in those since their history would lag behind.
+ */
+constexpr bool IS_ANIMATED[SCENE_COUNT] {
+    true, false, true, false, false, false,
+    true, false, true, true, true, false
+};
+
+/**
+ * @struct Ray
+ * @brief Represents a ray starting from an origin and going in a direction.
+ */
+struct Ray {
+    Point origin;     ///< The origin of the ray.
+    Vector direction; ///< The normalized direction of the ray.
+};
+
+/**
+ * @enum NormalMethod
+ * @brief How the normal of a surface is estimated. Must match the NORMAL constants of
+ * shaders/lighting.glsl.
+ */
+enum class NormalMethod : unsigned int {
+    central,    ///< Central differences along each axis, 6 samples.
+    tetrahedral ///< Differences along the vertices of a tetrahedron, 4 samples.
+};
+
+/**
+ * @enum AntiAliasing
+ * @brief How many samples are rendered per pixel. Must match the ANTI_ALIASING constants of
+ * shaders/anti_aliasing.glsl.
+ */
+enum class AntiAliasing : unsigned int {
+    none,     ///< One sample per pixel.
+    adaptive, ///< One sample per pixel, then 4 for the pixels on edges.
+    full,     ///< 4 samples per pixel in a rotated grid pattern.
+    temporal  ///< One sample per pixel accumulated over frames, see shaders/temporal.glsl.
+};
+
+constexpr unsigned int ANTI_ALIASING_COUNT = 4u; ///< The number of values of AntiAliasing.
+
+/**
+ * @struct Uniforms
+ * @brief Holds the values the fragment shader receives as uniforms.
+ */
+struct Uniforms {
+    vec2 resolution; ///< The resolution of the rendered image in pixels.
+    float time;      ///< The current time in seconds.
+
+    Point cameraPos;     ///< The position of the camera.
+    Vector cameraFront;  ///< The front vector of the camera.
+    Vector cameraRight;  ///< The right vector of the camera.
+    Vector cameraUp;     ///< The up vector of the camera.
+
+    unsigned int active_scene; ///< The id of the rendered scene.
+    bool hasLighting;          ///< Whether lighting is calculated.
+    bool isRelaxed;            ///< Whether rays are marched with over-relaxed sphere tracing.
+    bool isHitAdaptive;        ///< Whether hits and step budgets adapt to the footprint and scene.
+    NormalMethod normalMethod; ///< How the normals of the surfaces are estimated.
+    AntiAliasing antiAliasing; ///< How many samples are rendered per pixel.
+};
+
+/**
+ * @brief Whether a scene casts shadows. This replaces the 'hasShadows' global the GLSL scenes
+ * overwrite every time map() is called.
+ * @param scene The id of the scene.
+ * @return Whether the scene casts shadows.
+ */
+bool hasShadows(unsigned int scene);
+
+/**
+ * @brief Evaluates the active scene at a given position.
+ * @param pos The sampled position.
+ * @param uniforms The uniforms of the current frame.
+ * @return The color of the closest surface in the rgb components and its signed distance in w.
+ */
+vec4 map(const Point& pos, const Uniforms& uniforms);
+
+/**
+ * @brief Evaluates the distance to the active scene at a given position, without its colors.
+ * Secondary rays and normals only need this.
+ * @param pos The sampled position.
+ * @param uniforms The uniforms of the current frame.
+ * @return The signed distance to the closest surface.
+ */
+float mapDistance(const Point& pos, const Uniforms& uniforms);
+
+/**
+ * @brief Gets the over-relaxation factor rays are marched with.
+ * @param uniforms The uniforms of the current frame.
+ * @return The active scene's factor, or 1 if over-relaxation is disabled.
+ */
+float getRelaxation(const Uniforms& uniforms);
+
+/**
+ * @brief Gets the maximum number of steps of a ray.
+ * @param uniforms The uniforms of the current frame.
+ * @return The active scene's step budget, or MAX_STEPS if the hit test isn't adaptive.
+ */
+unsigned int getStepBudget(const Uniforms& uniforms);
+
+/**
+ * @brief Calculates the distance under which a ray hits a surface. It grows with the pixel's
+ * footprint so far rays stop as soon as they are closer than a fraction of a pixel.
+ * @param distanceFromOrigin The distance travelled along the ray.
+ * @param uniforms The uniforms of the current frame.
+ * @return The hit distance, MIN_DISTANCE if the hit test isn't adaptive.
+ */
+float getHitDistance(float distanceFromOrigin, const Uniforms& uniforms);
+
+/**
+ * @brief Marches a ray through the active scene. Steps are scaled by the relaxation factor as long
+ * as the unbounding spheres of consecutive samples overlap. When they don't, a surface may have
+ * been stepped over so the ray goes back to where plain sphere tracing would have been and carries
+ * on without relaxation.
+ * @param ray The ray.
+ * @param uniforms The uniforms of the current frame.
+ * @param color Set to the color of the hit surface. Left untouched if nothing was hit.
+ * @param steps Set to the number of times the scene was evaluated.
+ * @return The distance travelled along the ray, or MAX_DISTANCE if it ran out of steps.
+ */
+float raymarch(const Ray& ray, const Uniforms& uniforms, Color& color, unsigned int& steps);
+
+/**
+ * @brief Marches a ray through the active scene, see the overload counting the steps.
+ * @param ray The ray.
+ * @param uniforms The uniforms of the current frame.
+ * @param color Set to the color of the hit surface. Left untouched if nothing was hit.
+ * @return The distance travelled along the ray.
+ */
+float raymarch(const Ray& ray, const Uniforms& uniforms, Color& color);
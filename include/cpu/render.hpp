@@ -0,0 +1,114 @@
+/***************************************************************************************************
+ * @file  render.hpp
+ * @brief Declaration of the rendering functions of shaders/render.glsl and anti_aliasing.glsl
+ **************************************************************************************************/
+
+#pragma once
+
+#include "cpu/raymarching.hpp"
+#include "cpu/simd.hpp"
+#include "maths/vec2.hpp"
+#include "maths/vec3.hpp"
+#include "maths/vec4.hpp"
+
+constexpr float EDGE_DEPTH_THRESHOLD = 0.1f;  ///< Relative curvature of the inverse distance.
+constexpr float EDGE_NORMAL_THRESHOLD = 0.9f; ///< Cosine of the angle between two normals.
+constexpr float EDGE_COLOR_THRESHOLD = 0.1f;  ///< Difference of luminance.
+
+constexpr unsigned int ANTI_ALIASING_SAMPLE_COUNT = 4u; ///< The samples of renderAntiAliasing4.
+
+/**
+ * @brief Calculates the screen coordinates of a pixel, where y goes from -1 to 1.
+ * @param fragCoord The window coordinates of the pixel's center, with the origin at the bottom
+ * left like gl_FragCoord.
+ * @param offset A sub-pixel offset.
+ * @param uniforms The uniforms of the current frame.
+ * @return The screen coordinates.
+ */
+vec2 getUV(const vec2& fragCoord, const vec2& offset, const Uniforms& uniforms);
+
+/**
+ * @brief Calculates the ray of a sample of a pixel.
+ * @param fragCoord The window coordinates of the pixel's center.
+ * @param uvOffset The sub-pixel offset of the sample.
+ * @param uniforms The uniforms of the current frame.
+ * @return The ray from the camera through the sample.
+ */
+Ray getRay(const vec2& fragCoord, const vec2& uvOffset, const Uniforms& uniforms);
+
+/**
+ * @brief Gets the sub-pixel offset of one of the samples of renderAntiAliasing4.
+ * @param sample The index of the sample, below ANTI_ALIASING_SAMPLE_COUNT.
+ * @return The offset of the sample.
+ */
+vec2 getAntiAliasingOffset(unsigned int sample);
+
+/**
+ * @brief Renders a single sample of a pixel.
+ * @param fragCoord The window coordinates of the pixel's center.
+ * @param uvOffset The sub-pixel offset of the sample.
+ * @param uniforms The uniforms of the current frame.
+ * @param geometry Set to the normal of the surface in xyz, or zeros where it isn't calculated, and
+ * to the distance the ray travelled in w.
+ * @return The color of the sample.
+ */
+Color render(const vec2& fragCoord, const vec2& uvOffset, const Uniforms& uniforms,
+             vec4& geometry);
+
+/**
+ * @brief Renders a single sample of a pixel.
+ * @param fragCoord The window coordinates of the pixel's center.
+ * @param uvOffset The sub-pixel offset of the sample.
+ * @param uniforms The uniforms of the current frame.
+ * @return The color of the sample.
+ */
+Color render(const vec2& fragCoord, const vec2& uvOffset, const Uniforms& uniforms);
+
+/**
+ * @brief Lights a marched ray, or draws the sky if it didn't hit anything.
+ * @param ray The ray.
+ * @param distance The distance the ray travelled.
+ * @param surfaceColor The color of the surface the ray hit, if it hit one.
+ * @param uniforms The uniforms of the current frame.
+ * @param geometry Set to the normal of the surface in xyz, or zeros where it isn't calculated, and
+ * to the distance the ray travelled in w.
+ * @return The color of the sample.
+ */
+Color shade(const Ray& ray, float distance, const Color& surfaceColor, const Uniforms& uniforms,
+            vec4& geometry);
+
+/**
+ * @brief Renders a pixel with 4 samples in a rotated grid pattern.
+ * @param fragCoord The window coordinates of the pixel's center.
+ * @param uniforms The uniforms of the current frame.
+ * @return The color of the pixel.
+ */
+Color renderAntiAliasing4(const vec2& fragCoord, const Uniforms& uniforms);
+
+/**
+ * @brief Renders samples whose rays are marched in packets, then lit one by one.
+ * @param rays The rays of the samples.
+ * @param count The number of rays.
+ * @param uniforms The uniforms of the current frame.
+ * @param level The instruction set the rays are marched with.
+ * @param colors Set to the color of each sample.
+ * @param geometry Set to the geometry of each sample, as with render.
+ */
+void renderRays(const Ray* rays, unsigned int count, const Uniforms& uniforms, SIMDLevel level,
+                Color* colors, vec4* geometry);
+
+/**
+ * @brief Whether a pixel rendered with one sample lies on an edge and should be supersampled. The
+ * sample is compared with its two neighbors along an axis: an edge is a jump of the distance, a
+ * crease between normals or a contrast of colors.
+ * @param color The color of the pixel's sample.
+ * @param geometry The geometry of the pixel's sample, as returned by render.
+ * @param colorA The color of the first neighbor.
+ * @param geometryA The geometry of the first neighbor.
+ * @param colorB The color of the second neighbor.
+ * @param geometryB The geometry of the second neighbor.
+ * @return Whether the pixel is on an edge.
+ */
+bool isEdge(const Color& color, const vec4& geometry,
+            const Color& colorA, const vec4& geometryA,
+            const Color& colorB, const vec4& geometryB);
@@ -0,0 +1,78 @@
+/***************************************************************************************************
+ * @file  signed_distance_functions.hpp
+ * @brief Declaration of the signed distance functions of shaders/signed_distance_functions.glsl
+ **************************************************************************************************/
+
+#pragma once
+
+#include "maths/vec2.hpp"
+#include "maths/vec3.hpp"
+
+/**
+ * @brief Calculates the signed distance to an infinite plane.
+ * @param pos The sampled position.
+ * @param normal The normal of the plane.
+ * @param height The offset of the plane along its normal.
+ * @return The signed distance.
+ */
+float SDF_Plane(const Point& pos, const Vector& normal, float height);
+
+/**
+ * @brief Calculates the signed distance to a box centered on the origin.
+ * @param pos The sampled position.
+ * @param dimensions The half extents of the box.
+ * @return The signed distance.
+ */
+float SDF_Box(const Point& pos, const vec3& dimensions);
+
+/**
+ * @brief Calculates the signed distance to a box with rounded edges centered on the origin.
+ * @param pos The sampled position.
+ * @param dimensions The half extents of the box.
+ * @param radius The radius of the edges.
+ * @return The signed distance.
+ */
+float SDF_RoundBox(const Point& pos, const vec3& dimensions, float radius);
+
+/**
+ * @brief Calculates the signed distance to a sphere centered on the origin.
+ * @param pos The sampled position.
+ * @param radius The radius of the sphere.
+ * @return The signed distance.
+ */
+float SDF_Sphere(const Point& pos, float radius);
+
+/**
+ * @brief Calculates the signed distance to an infinite cylinder along the y axis.
+ * @param pos The sampled position.
+ * @param c The x and z coordinates of the axis followed by the radius.
+ * @return The signed distance.
+ */
+float SDF_Cylinder(const Point& pos, const vec3& c);
+
+/**
+ * @brief Calculates the signed distance to a capped cylinder centered on the origin.
+ * @param pos The sampled position.
+ * @param height The half height of the cylinder.
+ * @param radius The radius of the cylinder.
+ * @return The signed distance.
+ */
+float SDF_CappedCylinder(const Point& pos, float height, float radius);
+
+/**
+ * @brief Calculates the signed distance to a cone whose tip is on the origin.
+ * @param pos The sampled position.
+ * @param c The sine and cosine of the cone's angle.
+ * @param height The height of the cone.
+ * @return The signed distance.
+ */
+float SDF_Cone(const Point& pos, const vec2& c, float height);
+
+/**
+ * @brief Calculates the signed distance to a torus in the xz plane centered on the origin.
+ * @param pos The sampled position.
+ * @param Radius The distance from the center of the torus to the center of the tube.
+ * @param radius The radius of the tube.
+ * @return The signed distance.
+ */
+float SDF_Torus(const Point& pos, float Radius, float radius);
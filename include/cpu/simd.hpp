@@ -0,0 +1,80 @@
+/***************************************************************************************************
+ * @file  simd.hpp
+ * @brief Declaration of the packet ray marching and of the selection of its instruction set
+ **************************************************************************************************/
+
+#pragma once
+
+#include <string>
+
+#include "cpu/raymarching.hpp"
+
+/**
+ * @enum SIMDLevel
+ * @brief The instruction sets the packet marcher is compiled for, from the most widespread to the
+ * widest. Each level marches as many rays at a time as its registers hold floats.
+ */
+enum class SIMDLevel : unsigned int {
+    scalar, ///< One ray at a time with raymarch.
+    sse,    ///< 4 rays at a time with SSE4.1.
+    avx2,   ///< 8 rays at a time with AVX2 and FMA.
+    avx512  ///< 16 rays at a time with AVX-512F.
+};
+
+/**
+ * @brief Asks the CPU, through CPUID, for the widest instruction set it and the operating system
+ * support.
+ * @return The widest supported level, scalar on other architectures than x86.
+ */
+SIMDLevel getSupportedSIMDLevel();
+
+/**
+ * @brief Gets the name of a level, as accepted by parseSIMDLevel.
+ * @param level The level.
+ * @return The name.
+ */
+std::string getSIMDLevelName(SIMDLevel level);
+
+/**
+ * @brief Reads a level from its name.
+ * @param name "scalar", "sse", "avx2" or "avx512".
+ * @param level Set to the level if the name is valid.
+ * @return Whether the name is valid.
+ */
+bool parseSIMDLevel(const std::string& name, SIMDLevel& level);
+
+/**
+ * @brief Gets the number of rays marched at a time at a level.
+ * @param level The level.
+ * @return The number of lanes of its registers.
+ */
+unsigned int getPacketSize(SIMDLevel level);
+
+/**
+ * @brief Marches rays through the active scene, as many at a time as the registers of the level
+ * hold. The results are the same as with raymarch, up to rounding since the scene's sines are
+ * approximated in packets.
+ * @param rays The rays.
+ * @param count The number of rays. Fills the packets best when it is a multiple of the packet size.
+ * @param uniforms The uniforms of the current frame.
+ * @param level The instruction set to use, which the CPU must support.
+ * @param distances Set to the distance travelled along each ray.
+ * @param colors Set to the color of the surface each ray hit. Left untouched where nothing was hit.
+ * @param steps Set to the number of times the scene was evaluated for each ray.
+ */
+void raymarchPacket(const Ray* rays, unsigned int count, const Uniforms& uniforms, SIMDLevel level,
+                    float* distances, Color* colors, unsigned int* steps);
+
+/**** Packet marchers of each instruction set, see raymarchPackets in cpu/simd/raymarching.hpp ****/
+
+void raymarchPacketSSE(const Ray* rays, unsigned int count, const Uniforms& uniforms,
+                       float* distances, float* colorDistances, bool* isStopped,
+                       unsigned int* steps);
+
+void raymarchPacketAVX2(const Ray* rays, unsigned int count, const Uniforms& uniforms,
+                        float* distances, float* colorDistances, bool* isStopped,
+                        unsigned int* steps);
+
+void raymarchPacketAVX512(const Ray* rays, unsigned int count, const Uniforms& uniforms,
+                          float* distances, float* colorDistances, bool* isStopped,
+                          unsigned int* steps);
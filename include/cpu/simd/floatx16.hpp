@@ -0,0 +1,179 @@
+/***************************************************************************************************
+ * @file  floatx16.hpp
+ * @brief Declaration of the floatx16 and maskx16 structs, 16 lanes of AVX-512
+ **************************************************************************************************/
+
+#pragma once
+
+// GCC 12 warns that the placeholder registers of the unmasked AVX-512 intrinsics are uninitialized
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#include <immintrin.h>
+#pragma GCC diagnostic pop
+
+/**
+ * @struct maskx16
+ * @brief The result of comparing two floatx16, one bit per lane.
+ */
+struct maskx16 {
+    __mmask16 value; ///< The lanes.
+};
+
+/**
+ * @struct floatx16
+ * @brief 16 floats in an AVX-512 register. Only the source file compiled for AVX-512F may include
+ * this.
+ */
+struct floatx16 {
+    static constexpr unsigned int SIZE = 16u; ///< The number of lanes.
+
+    /**
+     * @brief Leaves the lanes uninitialized.
+     */
+    floatx16() = default;
+
+    /**
+     * @brief Sets every lane to the same value.
+     * @param scalar The value of the lanes.
+     */
+    floatx16(float scalar) : value(_mm512_set1_ps(scalar)) { }
+
+    /**
+     * @brief Wraps a register.
+     * @param value The lanes.
+     */
+    floatx16(__m512 value) : value(value) { }
+
+    /**
+     * @brief Reads consecutive floats, which don't need to be aligned.
+     * @param values The address of the first lane.
+     * @return The lanes.
+     */
+    static floatx16 load(const float* values) {
+        return _mm512_loadu_ps(values);
+    }
+
+    /**
+     * @brief Writes the lanes to consecutive floats, which don't need to be aligned.
+     * @param values The address of the first lane.
+     */
+    void store(float* values) const {
+        _mm512_storeu_ps(values, value);
+    }
+
+    __m512 value; ///< The lanes.
+};
+
+/**** Lane-wise operators and functions, named after their scalar and GLSL counterparts ****/
+
+inline floatx16 operator +(const floatx16& a, const floatx16& b) {
+    return _mm512_add_ps(a.value, b.value);
+}
+
+inline floatx16 operator -(const floatx16& a, const floatx16& b) {
+    return _mm512_sub_ps(a.value, b.value);
+}
+
+inline floatx16 operator *(const floatx16& a, const floatx16& b) {
+    return _mm512_mul_ps(a.value, b.value);
+}
+
+inline floatx16 operator /(const floatx16& a, const floatx16& b) {
+    return _mm512_div_ps(a.value, b.value);
+}
+
+inline floatx16& operator +=(floatx16& a, const floatx16& b) {
+    return a = a + b;
+}
+
+inline floatx16& operator -=(floatx16& a, const floatx16& b) {
+    return a = a - b;
+}
+
+inline floatx16& operator *=(floatx16& a, const floatx16& b) {
+    return a = a * b;
+}
+
+inline floatx16 operator -(const floatx16& a) {
+    // AVX-512F has no floating point xor
+    return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a.value),
+                                                _mm512_set1_epi32(static_cast<int>(0x80000000u))));
+}
+
+inline maskx16 operator <(const floatx16& a, const floatx16& b) {
+    return {_mm512_cmp_ps_mask(a.value, b.value, _CMP_LT_OQ)};
+}
+
+inline maskx16 operator >(const floatx16& a, const floatx16& b) {
+    return {_mm512_cmp_ps_mask(a.value, b.value, _CMP_GT_OQ)};
+}
+
+inline maskx16 operator >=(const floatx16& a, const floatx16& b) {
+    return {_mm512_cmp_ps_mask(a.value, b.value, _CMP_GE_OQ)};
+}
+
+inline maskx16 operator &(const maskx16& a, const maskx16& b) {
+    return {static_cast<__mmask16>(a.value & b.value)};
+}
+
+inline maskx16 operator |(const maskx16& a, const maskx16& b) {
+    return {static_cast<__mmask16>(a.value | b.value)};
+}
+
+inline maskx16 operator !(const maskx16& a) {
+    return {static_cast<__mmask16>(~a.value)};
+}
+
+/**
+ * @brief Whether a mask holds in at least one lane.
+ * @param mask The mask.
+ * @return Whether any lane is set.
+ */
+inline bool any(const maskx16& mask) {
+    return mask.value != 0;
+}
+
+/**
+ * @brief Whether a mask holds in every lane.
+ * @param mask The mask.
+ * @return Whether all lanes are set.
+ */
+inline bool all(const maskx16& mask) {
+    return mask.value == 0xFFFF;
+}
+
+/**
+ * @brief Picks each lane from one of two values, like the ternary operator.
+ * @param mask Where to pick the first value.
+ * @param a The value of the lanes where the mask is set.
+ * @param b The value of the other lanes.
+ * @return The picked lanes.
+ */
+inline floatx16 select(const maskx16& mask, const floatx16& a, const floatx16& b) {
+    return _mm512_mask_blend_ps(mask.value, b.value, a.value);
+}
+
+inline floatx16 min(const floatx16& a, const floatx16& b) {
+    return _mm512_min_ps(a.value, b.value);
+}
+
+inline floatx16 max(const floatx16& a, const floatx16& b) {
+    return _mm512_max_ps(a.value, b.value);
+}
+
+inline floatx16 abs(const floatx16& a) {
+    return _mm512_abs_ps(a.value);
+}
+
+inline floatx16 sqrt(const floatx16& a) {
+    return _mm512_sqrt_ps(a.value);
+}
+
+inline floatx16 floor(const floatx16& a) {
+    return _mm512_roundscale_ps(a.value, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+}
+
+inline floatx16 round(const floatx16& a) {
+    return _mm512_roundscale_ps(a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
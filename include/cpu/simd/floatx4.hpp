@@ -0,0 +1,171 @@
+/***************************************************************************************************
+ * @file  floatx4.hpp
+ * @brief Declaration of the floatx4 and maskx4 structs, 4 lanes of SSE4.1
+ **************************************************************************************************/
+
+#pragma once
+
+#include <smmintrin.h>
+
+/**
+ * @struct maskx4
+ * @brief The result of comparing two floatx4, each lane being all ones where it holds.
+ */
+struct maskx4 {
+    __m128 value; ///< The lanes.
+};
+
+/**
+ * @struct floatx4
+ * @brief 4 floats in an SSE register. Only the source file compiled for SSE4.1 may include this.
+ */
+struct floatx4 {
+    static constexpr unsigned int SIZE = 4u; ///< The number of lanes.
+
+    /**
+     * @brief Leaves the lanes uninitialized.
+     */
+    floatx4() = default;
+
+    /**
+     * @brief Sets every lane to the same value.
+     * @param scalar The value of the lanes.
+     */
+    floatx4(float scalar) : value(_mm_set1_ps(scalar)) { }
+
+    /**
+     * @brief Wraps a register.
+     * @param value The lanes.
+     */
+    floatx4(__m128 value) : value(value) { }
+
+    /**
+     * @brief Reads consecutive floats, which don't need to be aligned.
+     * @param values The address of the first lane.
+     * @return The lanes.
+     */
+    static floatx4 load(const float* values) {
+        return _mm_loadu_ps(values);
+    }
+
+    /**
+     * @brief Writes the lanes to consecutive floats, which don't need to be aligned.
+     * @param values The address of the first lane.
+     */
+    void store(float* values) const {
+        _mm_storeu_ps(values, value);
+    }
+
+    __m128 value; ///< The lanes.
+};
+
+/**** Lane-wise operators and functions, named after their scalar and GLSL counterparts ****/
+
+inline floatx4 operator +(const floatx4& a, const floatx4& b) {
+    return _mm_add_ps(a.value, b.value);
+}
+
+inline floatx4 operator -(const floatx4& a, const floatx4& b) {
+    return _mm_sub_ps(a.value, b.value);
+}
+
+inline floatx4 operator *(const floatx4& a, const floatx4& b) {
+    return _mm_mul_ps(a.value, b.value);
+}
+
+inline floatx4 operator /(const floatx4& a, const floatx4& b) {
+    return _mm_div_ps(a.value, b.value);
+}
+
+inline floatx4& operator +=(floatx4& a, const floatx4& b) {
+    return a = a + b;
+}
+
+inline floatx4& operator -=(floatx4& a, const floatx4& b) {
+    return a = a - b;
+}
+
+inline floatx4& operator *=(floatx4& a, const floatx4& b) {
+    return a = a * b;
+}
+
+inline floatx4 operator -(const floatx4& a) {
+    return _mm_xor_ps(a.value, _mm_set1_ps(-0.0f));
+}
+
+inline maskx4 operator <(const floatx4& a, const floatx4& b) {
+    return {_mm_cmplt_ps(a.value, b.value)};
+}
+
+inline maskx4 operator >(const floatx4& a, const floatx4& b) {
+    return {_mm_cmpgt_ps(a.value, b.value)};
+}
+
+inline maskx4 operator >=(const floatx4& a, const floatx4& b) {
+    return {_mm_cmpge_ps(a.value, b.value)};
+}
+
+inline maskx4 operator &(const maskx4& a, const maskx4& b) {
+    return {_mm_and_ps(a.value, b.value)};
+}
+
+inline maskx4 operator |(const maskx4& a, const maskx4& b) {
+    return {_mm_or_ps(a.value, b.value)};
+}
+
+inline maskx4 operator !(const maskx4& a) {
+    return {_mm_xor_ps(a.value, _mm_castsi128_ps(_mm_set1_epi32(-1)))};
+}
+
+/**
+ * @brief Whether a mask holds in at least one lane.
+ * @param mask The mask.
+ * @return Whether any lane is set.
+ */
+inline bool any(const maskx4& mask) {
+    return _mm_movemask_ps(mask.value) != 0;
+}
+
+/**
+ * @brief Whether a mask holds in every lane.
+ * @param mask The mask.
+ * @return Whether all lanes are set.
+ */
+inline bool all(const maskx4& mask) {
+    return _mm_movemask_ps(mask.value) == 0xF;
+}
+
+/**
+ * @brief Picks each lane from one of two values, like the ternary operator.
+ * @param mask Where to pick the first value.
+ * @param a The value of the lanes where the mask is set.
+ * @param b The value of the other lanes.
+ * @return The picked lanes.
+ */
+inline floatx4 select(const maskx4& mask, const floatx4& a, const floatx4& b) {
+    return _mm_blendv_ps(b.value, a.value, mask.value);
+}
+
+inline floatx4 min(const floatx4& a, const floatx4& b) {
+    return _mm_min_ps(a.value, b.value);
+}
+
+inline floatx4 max(const floatx4& a, const floatx4& b) {
+    return _mm_max_ps(a.value, b.value);
+}
+
+inline floatx4 abs(const floatx4& a) {
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), a.value);
+}
+
+inline floatx4 sqrt(const floatx4& a) {
+    return _mm_sqrt_ps(a.value);
+}
+
+inline floatx4 floor(const floatx4& a) {
+    return _mm_floor_ps(a.value);
+}
+
+inline floatx4 round(const floatx4& a) {
+    return _mm_round_ps(a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
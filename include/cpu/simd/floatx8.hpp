@@ -0,0 +1,172 @@
+/***************************************************************************************************
+ * @file  floatx8.hpp
+ * @brief Declaration of the floatx8 and maskx8 structs, 8 lanes of AVX2
+ **************************************************************************************************/
+
+#pragma once
+
+#include <immintrin.h>
+
+/**
+ * @struct maskx8
+ * @brief The result of comparing two floatx8, each lane being all ones where it holds.
+ */
+struct maskx8 {
+    __m256 value; ///< The lanes.
+};
+
+/**
+ * @struct floatx8
+ * @brief 8 floats in an AVX register. Only the source file compiled for AVX2 and FMA may include
+ * this.
+ */
+struct floatx8 {
+    static constexpr unsigned int SIZE = 8u; ///< The number of lanes.
+
+    /**
+     * @brief Leaves the lanes uninitialized.
+     */
+    floatx8() = default;
+
+    /**
+     * @brief Sets every lane to the same value.
+     * @param scalar The value of the lanes.
+     */
+    floatx8(float scalar) : value(_mm256_set1_ps(scalar)) { }
+
+    /**
+     * @brief Wraps a register.
+     * @param value The lanes.
+     */
+    floatx8(__m256 value) : value(value) { }
+
+    /**
+     * @brief Reads consecutive floats, which don't need to be aligned.
+     * @param values The address of the first lane.
+     * @return The lanes.
+     */
+    static floatx8 load(const float* values) {
+        return _mm256_loadu_ps(values);
+    }
+
+    /**
+     * @brief Writes the lanes to consecutive floats, which don't need to be aligned.
+     * @param values The address of the first lane.
+     */
+    void store(float* values) const {
+        _mm256_storeu_ps(values, value);
+    }
+
+    __m256 value; ///< The lanes.
+};
+
+/**** Lane-wise operators and functions, named after their scalar and GLSL counterparts ****/
+
+inline floatx8 operator +(const floatx8& a, const floatx8& b) {
+    return _mm256_add_ps(a.value, b.value);
+}
+
+inline floatx8 operator -(const floatx8& a, const floatx8& b) {
+    return _mm256_sub_ps(a.value, b.value);
+}
+
+inline floatx8 operator *(const floatx8& a, const floatx8& b) {
+    return _mm256_mul_ps(a.value, b.value);
+}
+
+inline floatx8 operator /(const floatx8& a, const floatx8& b) {
+    return _mm256_div_ps(a.value, b.value);
+}
+
+inline floatx8& operator +=(floatx8& a, const floatx8& b) {
+    return a = a + b;
+}
+
+inline floatx8& operator -=(floatx8& a, const floatx8& b) {
+    return a = a - b;
+}
+
+inline floatx8& operator *=(floatx8& a, const floatx8& b) {
+    return a = a * b;
+}
+
+inline floatx8 operator -(const floatx8& a) {
+    return _mm256_xor_ps(a.value, _mm256_set1_ps(-0.0f));
+}
+
+inline maskx8 operator <(const floatx8& a, const floatx8& b) {
+    return {_mm256_cmp_ps(a.value, b.value, _CMP_LT_OQ)};
+}
+
+inline maskx8 operator >(const floatx8& a, const floatx8& b) {
+    return {_mm256_cmp_ps(a.value, b.value, _CMP_GT_OQ)};
+}
+
+inline maskx8 operator >=(const floatx8& a, const floatx8& b) {
+    return {_mm256_cmp_ps(a.value, b.value, _CMP_GE_OQ)};
+}
+
+inline maskx8 operator &(const maskx8& a, const maskx8& b) {
+    return {_mm256_and_ps(a.value, b.value)};
+}
+
+inline maskx8 operator |(const maskx8& a, const maskx8& b) {
+    return {_mm256_or_ps(a.value, b.value)};
+}
+
+inline maskx8 operator !(const maskx8& a) {
+    return {_mm256_xor_ps(a.value, _mm256_castsi256_ps(_mm256_set1_epi32(-1)))};
+}
+
+/**
+ * @brief Whether a mask holds in at least one lane.
+ * @param mask The mask.
+ * @return Whether any lane is set.
+ */
+inline bool any(const maskx8& mask) {
+    return _mm256_movemask_ps(mask.value) != 0;
+}
+
+/**
+ * @brief Whether a mask holds in every lane.
+ * @param mask The mask.
+ * @return Whether all lanes are set.
+ */
+inline bool all(const maskx8& mask) {
+    return _mm256_movemask_ps(mask.value) == 0xFF;
+}
+
+/**
+ * @brief Picks each lane from one of two values, like the ternary operator.
+ * @param mask Where to pick the first value.
+ * @param a The value of the lanes where the mask is set.
+ * @param b The value of the other lanes.
+ * @return The picked lanes.
+ */
+inline floatx8 select(const maskx8& mask, const floatx8& a, const floatx8& b) {
+    return _mm256_blendv_ps(b.value, a.value, mask.value);
+}
+
+inline floatx8 min(const floatx8& a, const floatx8& b) {
+    return _mm256_min_ps(a.value, b.value);
+}
+
+inline floatx8 max(const floatx8& a, const floatx8& b) {
+    return _mm256_max_ps(a.value, b.value);
+}
+
+inline floatx8 abs(const floatx8& a) {
+    return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.value);
+}
+
+inline floatx8 sqrt(const floatx8& a) {
+    return _mm256_sqrt_ps(a.value);
+}
+
+inline floatx8 floor(const floatx8& a) {
+    return _mm256_floor_ps(a.value);
+}
+
+inline floatx8 round(const floatx8& a) {
+    return _mm256_round_ps(a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
@@ -0,0 +1,323 @@
+/***************************************************************************************************
+ * @file  maps.hpp
+ * @brief Lane-wise versions of the distance-only scenes of cpu/maps.hpp
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cmath>
+#include "cpu/raymarching.hpp"
+#include "cpu/simd/signed_distance_functions.hpp"
+#include "cpu/simd/utility.hpp"
+#include "cpu/simd/vec3xN.hpp"
+#include "maths/trigonometry.hpp"
+
+// The lanes of a packet are culled together: a group of SDFs is skipped only when it is culled in
+// every lane. Lanes where it is culled evaluate it anyway, which doesn't change their result since
+// the bound is below the group's distance.
+
+// Computed at compile time, no code of radians is emitted in the files of the instruction sets
+constexpr float QUARTER_TURN = radians(90.0f);
+
+template<typename Float>
+Float map1Distance(const vec3xN<Float>& pos, float time) {
+    vec3xN<Float> p = pos;
+    p.y -= time * 0.5f;
+    p = fract(p) - 0.5f;
+    rotate2D(p.x, p.z, time);
+    rotate2D(p.z, p.y, time);
+
+    return min(pos.y, SDF_Box(p, {0.1f, 0.1f, 0.1f}));
+}
+
+template<typename Float>
+Float map2Distance(const vec3xN<Float>& pos, float /* time */) {
+    vec3xN<Float> p;
+
+    const float repetition = 12.0f;
+    const float radius = 2.0f;
+    const vec3xN<Float> translation{5.5f * radius, 0.0f, 5.5f * radius};
+
+    p = mod(pos + translation, repetition) - 0.25f * repetition;
+    Float cylinder = SDF_Cylinder(p, radius, radius, radius);
+
+    p = mod(vec3xN<Float>{pos.z, pos.x, pos.y} + translation, repetition) - 0.25f * repetition;
+    cylinder = smin(cylinder, SDF_Cylinder(p, radius, radius, radius), 0.1f);
+
+    p = mod(vec3xN<Float>{pos.y, pos.z, pos.x} + translation, repetition) - 0.25f * repetition;
+    cylinder = smin(cylinder, SDF_Cylinder(p, radius, radius, radius), 0.1f);
+
+    p = mod(pos, repetition) - 0.5f * repetition;
+    const Float cube = -SDF_RoundBox(p, {4.0f, 4.0f, 4.0f}, 1.0f);
+
+    return smax(cube, -cylinder, 0.5f);
+}
+
+template<typename Float>
+Float map3Distance(const vec3xN<Float>& pos, float time) {
+    vec3xN<Float> p = pos;
+
+    p.x += time;
+    p.z += time;
+    rotate2D(p.x, p.y, QUARTER_TURN);
+    p.y = mod(p.y, 2.0f) - 0.5f;
+    p.z = mod(p.z, 2.0f) - 0.5f;
+    Float cylinder = SDF_Cylinder(p, 0.5f, 0.5f, 0.5f);
+
+    p = pos;
+    rotate2D(p.z, p.y, QUARTER_TURN);
+    p.x = mod(p.x, 2.0f) - 0.5f;
+    p.y = mod(p.y, 2.0f) - 0.5f;
+    cylinder = smin(cylinder, SDF_Cylinder(p, 0.5f, 0.5f, 0.5f), 0.2f);
+
+    const Float ground = SDF_Plane(pos, {0.0f, 1.0f, 0.0f}, 0.5f + 0.5f * sinf(time));
+
+    return smax(ground, -cylinder, 0.5f);
+}
+
+/**
+ * @brief Calculates the distance to the beams of a group of map4, 3 boxes crossing at its center.
+ * @param p The sampled positions, relative to the center of the group.
+ * @return The signed distance of each position.
+ */
+template<typename Float>
+Float map4Beams(const vec3xN<Float>& p) {
+    return min3(SDF_Box(p, {1.0f, 3.0f, 1.0f}), SDF_Box(p, {3.0f, 1.0f, 1.0f}),
+                SDF_Box(p, {1.0f, 1.0f, 3.0f}));
+}
+
+template<typename Float>
+Float map4Distance(const vec3xN<Float>& pos, float /* time */) {
+    vec3xN<Float> p;
+
+    const float distance = 8.0f;
+    const float smoothing = 1.0f;
+    const float radius = 3.75f; // Bounding sphere of a group, see map4
+
+    const vec3xN<Float> box{2.0f, 2.0f, 2.0f};
+
+    p = pos - vec3xN<Float>{distance, -2.0f * -distance, 0.0f};
+    Float result = SDF_Box(p, box);
+
+    p = pos - vec3xN<Float>{-distance, -2.0f * -distance, 0.0f};
+    if(!all(isCulled(SDF_Sphere(p, radius), result))) {
+        result = min(result, map4Beams(p));
+    }
+
+    p = pos - vec3xN<Float>{-distance, 0.0f, 0.0f};
+    if(!all(isCulled(SDF_Sphere(p, radius), result))) {
+        result = min(result, min(SDF_Box(p, box), map4Beams(p)));
+    }
+
+    p = pos;
+    if(!all(isCulled(SDF_Sphere(p, radius), result))) {
+        result = min(result, max(SDF_Box(p, box), map4Beams(p)));
+    }
+
+    p = pos - vec3xN<Float>{distance, 0.0f, 0.0f};
+    if(!all(isCulled(SDF_Sphere(p, radius), result))) {
+        result = min(result, max(SDF_Box(p, box), -map4Beams(p)));
+    }
+
+    p = pos - vec3xN<Float>{-distance, distance, 0.0f};
+    if(!all(isCulled(SDF_Sphere(p, radius), result))) {
+        result = min(result, smin(SDF_Box(p, box), map4Beams(p), smoothing));
+    }
+
+    p = pos - vec3xN<Float>{0.0f, distance, 0.0f};
+    if(!all(isCulled(SDF_Sphere(p, radius), result))) {
+        result = min(result, smax(SDF_Box(p, box), map4Beams(p), smoothing));
+    }
+
+    p = pos - vec3xN<Float>{distance, distance, 0.0f};
+    if(!all(isCulled(SDF_Sphere(p, radius), result))) {
+        result = min(result, smax(SDF_Box(p, box), -map4Beams(p), smoothing));
+    }
+
+    return result;
+}
+
+template<typename Float>
+Float map5Distance(const vec3xN<Float>& pos, float /* time */) {
+    return SDF_Plane(pos, {0.0f, 1.0f, 0.0f}, 1.0f);
+}
+
+template<typename Float>
+Float map6Distance(const vec3xN<Float>& pos, float /* time */) {
+    const float l = 1.0f, s = 4.0f;
+    const vec3xN<Float> p = pos - clamp(round(pos / s), -l, l) * s;
+
+    const Float cube = SDF_Sphere(p, 1.0f);
+
+    const float x = 0.4f, y = 1.5f, z = 0.4f;
+    const Float cross = min3(SDF_Box(p, {x, y, z}), SDF_Box(p, {y, z, x}), SDF_Box(p, {z, x, y}));
+
+    return max(cube, -cross);
+}
+
+template<typename Float>
+Float map7Distance(const vec3xN<Float>& pos, float time) {
+    vec3xN<Float> p = pos;
+    const Float ground = SDF_Plane(p, {0.0f, 1.0f, 0.0f}, 0.5f + 0.5f * sinf(time));
+
+    p = pos;
+    p.y += 0.5f;
+    rotate2D(p.x, p.y, QUARTER_TURN);
+    p.y = mod(p.y, 2.0f) - 1.0f;
+    p.z = mod(p.z, 2.0f) - 1.0f;
+    const Float cube = SDF_Box(p, {0.5f, 0.5f, 0.5f});
+
+    p = pos;
+    p.y -= time;
+    p.x = mod(p.x, 2.0f) - 1.0f;
+    p.z = mod(p.z, 2.0f) - 1.0f;
+    p.y = mod(p.y, 4.0f) - 2.0f;
+    const Float sphere = SDF_Sphere(p, 0.25f);
+
+    const Float ceiling = SDF_Plane(pos, {0.0f, -1.0f, 0.0f}, 4.0f);
+
+    return smin(smax(ground, -cube, 0.25f), max(sphere, -ceiling), 0.25f);
+}
+
+template<typename Float>
+Float map8Distance(const vec3xN<Float>& pos, float /* time */) {
+    vec3xN<Float> p = pos;
+
+    Float result = p.y;
+
+    p = pos;
+    p.y -= 5.0f;
+    Float house = SDF_Box(p, {5.0f, 5.0f, 5.0f});
+
+    if(all(isCulled(house, result))) {
+        return result;
+    }
+
+    p = pos;
+    p.y -= 4.05f;
+    house = max(house, -SDF_Box(p, {4.0f, 4.0f, 4.0f}));
+
+    p = pos - vec3xN<Float>{0.0f, 3.05f, 5.0f};
+    house = max(house, -SDF_Box(p, {2.0f, 3.0f, 2.0f}));
+
+    result = min(result, house);
+
+    p = pos - vec3xN<Float>{0.0f, 3.5f, 0.0f};
+    if(all(isCulled(SDF_Sphere(p, 3.6f), result))) {
+        return result;
+    }
+
+    p = pos;
+    p.y -= 1.5f;
+    Float snowman = SDF_Sphere(p, 1.5f);
+
+    p.y -= 2.25f;
+    snowman = smin(snowman, SDF_Sphere(p, 1.0f), 0.15f);
+
+    p.y -= 1.5f;
+    snowman = smin(snowman, SDF_Sphere(p, 0.6f), 0.15f);
+
+    const Float eyes = min(SDF_Sphere(pos - vec3xN<Float>{0.3f, 5.4f, 0.5f}, 0.05f),
+                           SDF_Sphere(pos - vec3xN<Float>{-0.3f, 5.4f, 0.5f}, 0.05f));
+
+    p = pos - vec3xN<Float>{0.0f, 5.25f, 1.1f};
+    rotate2D(p.z, p.y, QUARTER_TURN);
+    const float angle = 7.5f * M_PIf / 180.0f;
+    const Float nose = SDF_Cone(p, sinf(angle), cosf(angle), 0.5f);
+
+    return min(result, smin(snowman, min(eyes, nose), 0.01f));
+}
+
+template<typename Float>
+Float map9Distance(const vec3xN<Float>& pos, float time) {
+    vec3xN<Float> p = pos;
+    const Float ground = p.y + 1.0f;
+
+    const Float sphere = SDF_Sphere(pos, 1.5f);
+    const vec3xN<Float> cube{1.0f, 1.0f, 1.0f};
+
+    p = pos;
+    p.y -= 1.0f + sinf(time);
+    Float cube1 = SDF_RoundBox(p, cube, 0.1f);
+
+    p = pos;
+    p.x -= 1.0f + sinf(time);
+    const Float cube2 = SDF_RoundBox(p, cube, 0.1f);
+
+    p = pos;
+    p.x += 1.0f + sinf(time);
+    const Float cube3 = SDF_RoundBox(p, cube, 0.1f);
+
+    cube1 = smin(cube1, smin(cube2, cube3, 0.5f), 0.5f);
+
+    return min(ground, smin(sphere, cube1, 0.5f));
+}
+
+template<typename Float>
+Float map10Distance(const vec3xN<Float>& pos, float time) {
+    const vec3xN<Float> p = pos;
+
+    const Float displacement = sin(p.x + time * 2.0f) * sin(p.y + time * 0.5f)
+                               * sin(p.z + time * 3.0f);
+
+    return min(p.y + 10.0f, SDF_Sphere(p, 10.0f + displacement));
+}
+
+template<typename Float>
+Float map11Distance(const vec3xN<Float>& pos, float time) {
+    const float R = 50.0f;
+
+    const Float circleX = SDF_Torus(pos - vec3xN<Float>{-R / 2.0f, 0.0f, 0.0f}, R, 0.0f);
+    const Float circleY = SDF_Torus(pos - vec3xN<Float>{R / 2.0f, 0.0f, 0.0f}, R, 0.0f);
+    const Float circleZ = SDF_Torus(vec3xN<Float>{pos.x, pos.z, pos.y}, R, 0.0f);
+
+    // See map11, the lanes out of the bound keep it as their distance
+    const Float bound = min3(circleX, circleY, circleZ) - 3.25f;
+    const auto isOutside = isCulled(bound, 1.0f);
+    if(all(isOutside)) {
+        return bound;
+    }
+
+    const vec3xN<Float> p = pos;
+
+    const Float displacement = sin(p.x + 2.0f * time)
+                               * sin(p.y + sinf(0.25f * time))
+                               * sin(p.z + 3.0f * time);
+    const Float r = 2.0f + displacement;
+
+    return select(isOutside, bound,
+                  smin(smin(circleX - r, circleY - r, 0.5f), circleZ - r, 0.5f));
+}
+
+template<typename Float>
+Float map12Distance(const vec3xN<Float>& pos, float /* time */) {
+    vec3xN<Float> p = pos;
+    p.y += 1.0f;
+
+    return SDF_Box(p, {8.0f, 1.0f, 8.0f});
+}
+
+/**
+ * @brief Evaluates the distance to the active scene at given positions, like mapDistance.
+ * @param pos The sampled positions.
+ * @param uniforms The uniforms of the current frame.
+ * @return The signed distance of each position to the closest surface.
+ */
+template<typename Float>
+Float mapDistance(const vec3xN<Float>& pos, const Uniforms& uniforms) {
+    switch(uniforms.active_scene) {
+        case 0u: return map1Distance(pos, uniforms.time);
+        case 1u: return map2Distance(pos, uniforms.time);
+        case 2u: return map3Distance(pos, uniforms.time);
+        case 3u: return map4Distance(pos, uniforms.time);
+        case 4u: return map5Distance(pos, uniforms.time);
+        case 5u: return map6Distance(pos, uniforms.time);
+        case 6u: return map7Distance(pos, uniforms.time);
+        case 7u: return map8Distance(pos, uniforms.time);
+        case 8u: return map9Distance(pos, uniforms.time);
+        case 9u: return map10Distance(pos, uniforms.time);
+        case 10u: return map11Distance(pos, uniforms.time);
+        case 11u: return map12Distance(pos, uniforms.time);
+        default: return map1Distance(pos, uniforms.time);
+    }
+}
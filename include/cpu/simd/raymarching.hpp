@@ -0,0 +1,136 @@
+/***************************************************************************************************
+ * @file  raymarching.hpp
+ * @brief Lane-wise version of the raymarch function of cpu/raymarching.hpp
+ **************************************************************************************************/
+
+#pragma once
+
+#include "cpu/raymarching.hpp"
+#include "cpu/simd/maps.hpp"
+#include "cpu/simd/vec3xN.hpp"
+
+/**
+ * @brief Calculates the distance under which rays hit a surface, like getHitDistance.
+ * @param distanceFromOrigin The distance travelled along each ray.
+ * @param uniforms The uniforms of the current frame.
+ * @return The hit distance of each ray.
+ */
+template<typename Float>
+Float getHitDistance(const Float& distanceFromOrigin, const Uniforms& uniforms) {
+    if(!uniforms.isHitAdaptive) {
+        return Float(MIN_DISTANCE);
+    }
+
+    const Float footprint = 2.0f * distanceFromOrigin / uniforms.resolution.y;
+    return max(MIN_DISTANCE, HIT_FOOTPRINT * footprint);
+}
+
+/**
+ * @brief Marches rays through the active scene as many at a time as Float has lanes, following
+ * the same steps as raymarch does for each ray. A packet keeps going while any of its rays does,
+ * the lanes of the others being masked. Only the distance to the scene is evaluated, the color
+ * where a ray stopped is left to the caller.
+ * @param rays The rays.
+ * @param count The number of rays. The last packet is completed with masked lanes.
+ * @param uniforms The uniforms of the current frame.
+ * @param distances Set to the distance travelled along each ray, or MAX_DISTANCE for those that
+ * ran out of steps.
+ * @param colorDistances Set to the distance along each ray at which the scene was sampled last,
+ * where raymarch takes the color from. Negative for rays that started inside a surface.
+ * @param isStopped Set to whether each ray stopped before running out of steps, raymarch leaving
+ * the color untouched otherwise.
+ * @param steps Set to the number of times the scene was evaluated for each ray.
+ */
+template<typename Float>
+void raymarchPackets(const Ray* rays, unsigned int count, const Uniforms& uniforms,
+                     float* distances, float* colorDistances, bool* isStopped,
+                     unsigned int* steps) {
+    constexpr unsigned int SIZE = Float::SIZE;
+    constexpr float LANE_INDICES[16] {
+        0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f,
+        8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f
+    };
+    static_assert(SIZE <= 16u, "LANE_INDICES must cover every lane.");
+
+    const unsigned int stepBudget = getStepBudget(uniforms);
+    const float startRelaxation = getRelaxation(uniforms);
+
+    for(unsigned int first = 0u ; first < count ; first += SIZE) {
+        const unsigned int laneCount = count - first < SIZE ? count - first : SIZE;
+
+        // Masked lanes march a copy of the last ray so they never sample garbage
+        float components[6][SIZE];
+        for(unsigned int lane = 0u ; lane < SIZE ; ++lane) {
+            const Ray& ray = rays[first + (lane < laneCount ? lane : laneCount - 1u)];
+            components[0][lane] = ray.origin.x;
+            components[1][lane] = ray.origin.y;
+            components[2][lane] = ray.origin.z;
+            components[3][lane] = ray.direction.x;
+            components[4][lane] = ray.direction.y;
+            components[5][lane] = ray.direction.z;
+        }
+
+        const vec3xN<Float> origin{
+            Float::load(components[0]), Float::load(components[1]), Float::load(components[2])
+        };
+        const vec3xN<Float> direction{
+            Float::load(components[3]), Float::load(components[4]), Float::load(components[5])
+        };
+
+        auto isActive = Float::load(LANE_INDICES) < static_cast<float>(laneCount);
+
+        Float relaxation = startRelaxation;
+        Float distanceFromOrigin = 0.0f;
+        Float previousRadius = 0.0f;
+        Float stepLength = 0.0f;
+        Float colorDistance = 0.0f;
+        Float stopped = 0.0f;
+        Float stepCount = 0.0f;
+
+        for(unsigned int step = 0u ; step < stepBudget && any(isActive) ; ++step) {
+            const Float distance = mapDistance(origin + direction * distanceFromOrigin, uniforms);
+            stepCount = select(isActive, stepCount + 1.0f, stepCount);
+
+            const Float radius = abs(distance);
+
+            // Rays whose unbounding spheres don't overlap go back and stop relaxing, see raymarch
+            const auto isOvershot = isActive & (relaxation > 1.0f)
+                                    & (radius + previousRadius < stepLength);
+            distanceFromOrigin = select(isOvershot,
+                                        distanceFromOrigin - (stepLength - stepLength / relaxation),
+                                        distanceFromOrigin);
+            relaxation = select(isOvershot, Float(1.0f), relaxation);
+
+            const auto isStepping = isActive & !isOvershot;
+            const Float sampleDistance = distanceFromOrigin;
+
+            stepLength = select(isStepping, relaxation * distance, stepLength);
+            previousRadius = select(isStepping, radius, previousRadius);
+            distanceFromOrigin = select(isStepping, distanceFromOrigin + stepLength,
+                                        distanceFromOrigin);
+
+            const auto isStopped = isStepping
+                                   & ((radius < getHitDistance(distanceFromOrigin, uniforms))
+                                      | (distanceFromOrigin >= MAX_DISTANCE));
+            colorDistance = select(isStopped, sampleDistance, colorDistance);
+            stopped = select(isStopped, Float(1.0f), stopped);
+            isActive = isActive & !isStopped;
+        }
+
+        // Rays that run out of steps haven't found a surface
+        distanceFromOrigin = select(stopped > 0.0f, distanceFromOrigin, Float(MAX_DISTANCE));
+
+        float laneDistances[SIZE], laneColorDistances[SIZE], laneStopped[SIZE], laneSteps[SIZE];
+        distanceFromOrigin.store(laneDistances);
+        colorDistance.store(laneColorDistances);
+        stopped.store(laneStopped);
+        stepCount.store(laneSteps);
+
+        for(unsigned int lane = 0u ; lane < laneCount ; ++lane) {
+            distances[first + lane] = laneDistances[lane];
+            colorDistances[first + lane] = laneColorDistances[lane];
+            isStopped[first + lane] = laneStopped[lane] > 0.0f;
+            steps[first + lane] = static_cast<unsigned int>(laneSteps[lane]);
+        }
+    }
+}
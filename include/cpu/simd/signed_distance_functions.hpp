@@ -0,0 +1,128 @@
+/***************************************************************************************************
+ * @file  signed_distance_functions.hpp
+ * @brief Lane-wise versions of the signed distance functions of
+ * shaders/signed_distance_functions.glsl
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cmath>
+#include "cpu/simd/utility.hpp"
+#include "cpu/simd/vec3xN.hpp"
+
+/**
+ * @brief Calculates the signed distance to an infinite plane.
+ * @param pos The sampled positions.
+ * @param normal The normal of the plane, which doesn't need to be normalized.
+ * @param height The offset of the plane along its normal.
+ * @return The signed distance of each position.
+ */
+template<typename Float>
+Float SDF_Plane(const vec3xN<Float>& pos, const float (&normal)[3], float height) {
+    const float norm = sqrtf(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+    return (normal[0] / norm) * pos.x + (normal[1] / norm) * pos.y + (normal[2] / norm) * pos.z
+           + height;
+}
+
+/**
+ * @brief Calculates the signed distance to a box centered on the origin.
+ * @param pos The sampled positions.
+ * @param dimensions The half extents of the box.
+ * @return The signed distance of each position.
+ */
+template<typename Float>
+Float SDF_Box(const vec3xN<Float>& pos, const vec3xN<Float>& dimensions) {
+    const vec3xN<Float> q = abs(pos) - dimensions;
+    return length(max(q, 0.0f)) + min(max3(q.x, q.y, q.z), 0.0f);
+}
+
+/**
+ * @brief Calculates the signed distance to a box with rounded edges centered on the origin.
+ * @param pos The sampled positions.
+ * @param dimensions The half extents of the box.
+ * @param radius The radius of the edges.
+ * @return The signed distance of each position.
+ */
+template<typename Float>
+Float SDF_RoundBox(const vec3xN<Float>& pos, const vec3xN<Float>& dimensions, float radius) {
+    const vec3xN<Float> q = abs(pos) - dimensions + radius;
+    return length(max(q, 0.0f)) + min(max3(q.x, q.y, q.z), 0.0f) - radius;
+}
+
+/**
+ * @brief Calculates the signed distance to a sphere centered on the origin.
+ * @param pos The sampled positions.
+ * @param radius The radius of the sphere.
+ * @return The signed distance of each position.
+ */
+template<typename Float>
+Float SDF_Sphere(const vec3xN<Float>& pos, const Lanes<Float>& radius) {
+    return length(pos) - radius;
+}
+
+/**
+ * @brief Calculates the signed distance to an infinite cylinder along the y axis.
+ * @param pos The sampled positions.
+ * @param x The x coordinate of the axis.
+ * @param z The z coordinate of the axis.
+ * @param radius The radius of the cylinder.
+ * @return The signed distance of each position.
+ */
+template<typename Float>
+Float SDF_Cylinder(const vec3xN<Float>& pos, float x, float z, float radius) {
+    return length(pos.x - x, pos.z - z) - radius;
+}
+
+/**
+ * @brief Calculates the signed distance to a capped cylinder centered on the origin.
+ * @param pos The sampled positions.
+ * @param height The half height of the cylinder.
+ * @param radius The radius of the cylinder.
+ * @return The signed distance of each position.
+ */
+template<typename Float>
+Float SDF_CappedCylinder(const vec3xN<Float>& pos, float height, float radius) {
+    const Float dx = abs(length(pos.x, pos.z)) - radius;
+    const Float dy = abs(pos.y) - height;
+    return min(max(dx, dy), 0.0f) + length(max(dx, 0.0f), max(dy, 0.0f));
+}
+
+/**
+ * @brief Calculates the signed distance to a cone whose tip is on the origin.
+ * @param pos The sampled positions.
+ * @param sine The sine of the cone's angle.
+ * @param cosine The cosine of the cone's angle.
+ * @param height The height of the cone.
+ * @return The signed distance of each position.
+ */
+template<typename Float>
+Float SDF_Cone(const vec3xN<Float>& pos, float sine, float cosine, float height) {
+    const float qx = height * (sine / cosine);
+    const float qy = -height;
+    const float k = qy > 0.0f ? 1.0f : (qy < 0.0f ? -1.0f : 0.0f);
+
+    const Float wx = length(pos.x, pos.z);
+    const Float wy = pos.y;
+
+    const Float t = clamp((wx * qx + wy * qy) / (qx * qx + qy * qy), 0.0f, 1.0f);
+    const Float ax = wx - qx * t;
+    const Float ay = wy - qy * t;
+    const Float bx = wx - qx * clamp(wx / qx, 0.0f, 1.0f);
+    const Float by = wy - qy;
+
+    const Float d = min(ax * ax + ay * ay, bx * bx + by * by);
+    const Float s = max(k * (wx * qy - wy * qx), k * (wy - qy));
+    return sqrt(d) * sign(s);
+}
+
+/**
+ * @brief Calculates the signed distance to a torus in the xz plane centered on the origin.
+ * @param pos The sampled positions.
+ * @param Radius The distance from the center of the torus to the center of the tube.
+ * @param radius The radius of the tube.
+ * @return The signed distance of each position.
+ */
+template<typename Float>
+Float SDF_Torus(const vec3xN<Float>& pos, float Radius, float radius) {
+    return length(length(pos.x, pos.z) - Radius, pos.y) - radius;
+}
@@ -0,0 +1,118 @@
+/***************************************************************************************************
+ * @file  utility.hpp
+ * @brief Lane-wise versions of the functions of shaders/utility.glsl and of maths/common.hpp
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cmath>
+#include "cpu/simd/vec3xN.hpp"
+
+template<typename Float>
+Float clamp(const Float& x, const Lanes<Float>& low, const Lanes<Float>& high) {
+    return min(max(x, low), high);
+}
+
+template<typename Float>
+Float mix(const Float& a, const Float& b, const Float& t) {
+    return a + (b - a) * t;
+}
+
+/**
+ * @brief Calculates x modulo y the same way GLSL does, see the scalar mod.
+ */
+template<typename Float>
+Float mod(const Float& x, const Lanes<Float>& y) {
+    return x - y * floor(x / y);
+}
+
+template<typename Float>
+vec3xN<Float> mod(const vec3xN<Float>& vec, const Lanes<Float>& scalar) {
+    return {mod(vec.x, scalar), mod(vec.y, scalar), mod(vec.z, scalar)};
+}
+
+template<typename Float>
+vec3xN<Float> fract(const vec3xN<Float>& vec) {
+    return {vec.x - floor(vec.x), vec.y - floor(vec.y), vec.z - floor(vec.z)};
+}
+
+template<typename Float>
+vec3xN<Float> clamp(const vec3xN<Float>& vec, const Lanes<Float>& low, const Lanes<Float>& high) {
+    return {clamp(vec.x, low, high), clamp(vec.y, low, high), clamp(vec.z, low, high)};
+}
+
+/**
+ * @brief Extracts the sign of each lane.
+ * @param x The lanes.
+ * @return -1 where a lane is negative, 1 where it is positive and 0 elsewhere.
+ */
+template<typename Float>
+Float sign(const Float& x) {
+    return select(x > 0.0f, Float(1.0f), select(x < 0.0f, Float(-1.0f), Float(0.0f)));
+}
+
+/**
+ * @brief Calculates the sine of each lane. The angle is brought back to [-pi/2, pi/2], where the
+ * sine is symmetric around pi/2 and matches its Taylor series to about 1e-7.
+ * @param x The angles in radians.
+ * @return The sine of each angle.
+ */
+template<typename Float>
+Float sin(const Float& x) {
+    constexpr float PI = 3.14159265f;
+
+    Float r = x - 2.0f * PI * round(x * (0.5f / PI));
+    r = select(r > 0.5f * PI, PI - r, select(r < -0.5f * PI, -PI - r, r));
+
+    const Float r2 = r * r;
+    return r * (1.0f + r2 * (-1.0f / 6.0f + r2 * (1.0f / 120.0f + r2 * (-1.0f / 5040.0f
+                + r2 * (1.0f / 362880.0f + r2 * (-1.0f / 39916800.0f))))));
+}
+
+/**
+ * @brief Rotates 2 dimensional vectors by the same angle, like rotation2D.
+ * @param x The x component of each vector, set to the rotated one.
+ * @param y The y component of each vector, set to the rotated one.
+ * @param angle The angle of the rotation in radians.
+ */
+template<typename Float>
+void rotate2D(Float& x, Float& y, float angle) {
+    const float cosine = cosf(angle);
+    const float sine = sinf(angle);
+
+    const Float rotatedX = cosine * x - sine * y;
+    y = sine * x + cosine * y;
+    x = rotatedX;
+}
+
+template<typename Float>
+Float smin(const Float& a, const Float& b, float t) {
+    const Float h = clamp(0.5f + 0.5f * (a - b) / t, 0.0f, 1.0f);
+    return mix(a, b, h) - t * h * (1.0f - h);
+}
+
+template<typename Float>
+Float smax(const Float& a, const Float& b, float t) {
+    const Float h = clamp(0.5f - 0.5f * (a - b) / t, 0.0f, 1.0f);
+    return mix(a, b, h) + t * h * (1.0f - h);
+}
+
+template<typename Float>
+Float min3(const Float& a, const Float& b, const Float& c) {
+    return min(a, min(b, c));
+}
+
+template<typename Float>
+Float max3(const Float& a, const Float& b, const Float& c) {
+    return max(a, max(b, c));
+}
+
+/**
+ * @brief Whether the groups bounded by some distances can't be closer than the closest surfaces
+ * found so far, see the scalar isCulled.
+ * @return Where the groups can be skipped. The scenes only skip them when every lane can.
+ */
+template<typename Float>
+auto isCulled(const Float& bound, const Lanes<Float>& closest) {
+    return bound > closest;
+}
@@ -0,0 +1,94 @@
+/***************************************************************************************************
+ * @file  vec3xN.hpp
+ * @brief Declaration of the vec3xN struct, a vec3 per lane of a SIMD register
+ **************************************************************************************************/
+
+#pragma once
+
+#include <type_traits>
+
+/**
+ * @brief The type of a parameter taking lanes. Unlike Float, it isn't deduced so a float can be
+ * passed and is converted to lanes that all hold it.
+ */
+template<typename Float>
+using Lanes = std::type_identity_t<Float>;
+
+/**
+ * @struct vec3xN
+ * @brief Represents as many 3 dimensional vectors as Float has lanes, stored as structure of
+ * arrays so each component fills a register.
+ * @tparam Float The lanes, floatx4, floatx8 or floatx16.
+ */
+template<typename Float>
+struct vec3xN {
+    Float x; ///< The x component of each vector.
+    Float y; ///< The y component of each vector.
+    Float z; ///< The z component of each vector.
+};
+
+template<typename Float>
+vec3xN<Float> operator +(const vec3xN<Float>& a, const vec3xN<Float>& b) {
+    return {a.x + b.x, a.y + b.y, a.z + b.z};
+}
+
+template<typename Float>
+vec3xN<Float> operator -(const vec3xN<Float>& a, const vec3xN<Float>& b) {
+    return {a.x - b.x, a.y - b.y, a.z - b.z};
+}
+
+template<typename Float>
+vec3xN<Float> operator +(const vec3xN<Float>& vec, const Lanes<Float>& scalar) {
+    return {vec.x + scalar, vec.y + scalar, vec.z + scalar};
+}
+
+template<typename Float>
+vec3xN<Float> operator -(const vec3xN<Float>& vec, const Lanes<Float>& scalar) {
+    return {vec.x - scalar, vec.y - scalar, vec.z - scalar};
+}
+
+template<typename Float>
+vec3xN<Float> operator *(const vec3xN<Float>& vec, const Lanes<Float>& scalar) {
+    return {vec.x * scalar, vec.y * scalar, vec.z * scalar};
+}
+
+template<typename Float>
+vec3xN<Float> operator /(const vec3xN<Float>& vec, const Lanes<Float>& scalar) {
+    return {vec.x / scalar, vec.y / scalar, vec.z / scalar};
+}
+
+template<typename Float>
+vec3xN<Float> abs(const vec3xN<Float>& vec) {
+    return {abs(vec.x), abs(vec.y), abs(vec.z)};
+}
+
+template<typename Float>
+vec3xN<Float> max(const vec3xN<Float>& vec, const Lanes<Float>& scalar) {
+    return {max(vec.x, scalar), max(vec.y, scalar), max(vec.z, scalar)};
+}
+
+template<typename Float>
+vec3xN<Float> round(const vec3xN<Float>& vec) {
+    return {round(vec.x), round(vec.y), round(vec.z)};
+}
+
+template<typename Float>
+Float dot(const vec3xN<Float>& a, const vec3xN<Float>& b) {
+    return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+template<typename Float>
+Float length(const vec3xN<Float>& vec) {
+    return sqrt(dot(vec, vec));
+}
+
+/**
+ * @brief Calculates the length of 2 dimensional vectors, which the SDFs build from 2 components.
+ * @param x The x component of each vector.
+ * @param y The y component of each vector.
+ * @return The length of each vector.
+ */
+template<typename Float>
+Float length(const Float& x, const Float& y) {
+    return sqrt(x * x + y * y);
+}
@@ -0,0 +1,26 @@
+/***************************************************************************************************
+ * @file  transformations.hpp
+ * @brief Declaration of the 3D transformation functions of shaders/transformations.glsl
+ **************************************************************************************************/
+
+#pragma once
+
+#include "maths/vec2.hpp"
+#include "maths/vec3.hpp"
+
+/**
+ * @brief Rotates a 2D vector. This is the equivalent of 'vec *= rotation2D(angle)' in GLSL.
+ * @param vec The vector to rotate.
+ * @param angle The rotation angle in radians.
+ * @return The rotated vector.
+ */
+vec2 rotation2D(const vec2& vec, float angle);
+
+/**
+ * @brief Rotates a point around an axis using Rodrigues' rotation formula.
+ * @param point The point to rotate.
+ * @param axis The normalized rotation axis.
+ * @param angle The rotation angle in radians.
+ * @return The rotated point.
+ */
+Point rotation3D(const Point& point, const Vector& axis, float angle);
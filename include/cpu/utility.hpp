@@ -0,0 +1,112 @@
+/***************************************************************************************************
+ * @file  utility.hpp
+ * @brief Declaration of the utility functions of shaders/utility.glsl
+ **************************************************************************************************/
+
+#pragma once
+
+#include "maths/vec3.hpp"
+#include "maths/vec4.hpp"
+
+/**
+ * @brief Calculates the smooth minimum of two distances.
+ * @param a The first distance.
+ * @param b The second distance.
+ * @param t The smoothing factor.
+ * @return The smooth minimum.
+ */
+float smin(float a, float b, float t);
+
+/**
+ * @brief Calculates the smooth maximum of two distances.
+ * @param a The first distance.
+ * @param b The second distance.
+ * @param t The smoothing factor.
+ * @return The smooth maximum.
+ */
+float smax(float a, float b, float t);
+
+/**
+ * @brief Calculates the minimum of three values.
+ * @param a, b, c The values.
+ * @return The minimum.
+ */
+float min3(float a, float b, float c);
+
+/**
+ * @brief Calculates the maximum of three values.
+ * @param a, b, c The values.
+ * @return The maximum.
+ */
+float max3(float a, float b, float c);
+
+/**
+ * @brief Whether a group of SDFs inside a bounding volume can be skipped. The group can't be closer
+ * than its bound, so when the bound is already farther than the closest surface found so far the
+ * union would keep that surface either way.
+ * @param bound The distance to the bounding volume.
+ * @param closest The distance to the closest surface found so far.
+ * @return Whether the group's children don't need to be evaluated.
+ */
+bool isCulled(float bound, float closest);
+
+/**
+ * @brief Intersects two colored shapes. The rgb components hold the color and w the distance.
+ * @param a The first shape.
+ * @param b The second shape.
+ * @return The intersection.
+ */
+vec4 intersectSDF(const vec4& a, const vec4& b);
+
+/**
+ * @brief Unites two colored shapes. The rgb components hold the color and w the distance.
+ * @param a The first shape.
+ * @param b The second shape.
+ * @return The union.
+ */
+vec4 unionSDF(const vec4& a, const vec4& b);
+
+/**
+ * @brief Subtracts a colored shape from another. The rgb components hold the color and w the
+ * distance.
+ * @param a The shape to subtract from.
+ * @param b The shape to subtract.
+ * @return The difference.
+ */
+vec4 differenceSDF(const vec4& a, const vec4& b);
+
+/**
+ * @brief Smoothly intersects two colored shapes, blending their colors.
+ * @param a The first shape.
+ * @param b The second shape.
+ * @param t The smoothing factor.
+ * @return The smooth intersection.
+ */
+vec4 sIntersectSDF(const vec4& a, const vec4& b, float t);
+
+/**
+ * @brief Smoothly unites two colored shapes, blending their colors.
+ * @param a The first shape.
+ * @param b The second shape.
+ * @param t The smoothing factor.
+ * @return The smooth union.
+ */
+vec4 sUnionSDF(const vec4& a, const vec4& b, float t);
+
+/**
+ * @brief Smoothly subtracts a colored shape from another, blending their colors.
+ * @param a The shape to subtract from.
+ * @param b The shape to subtract.
+ * @param t The smoothing factor.
+ * @return The smooth difference.
+ */
+vec4 sDifferenceSDF(const vec4& a, const vec4& b, float t);
+
+/**
+ * @brief Calculates the color of a checkerboard pattern of unit squares in the xz plane.
+ * @param pos The sampled position.
+ * @param col1 The color of the even squares.
+ * @param col2 The color of the odd squares.
+ * @return The color at the given position.
+ */
+Color checker(const Point& pos, const Color& col1, const Color& col2);
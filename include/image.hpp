@@ -0,0 +1,46 @@
+/***************************************************************************************************
+ * @file  image.hpp
+ * @brief Declaration of functions to write rendered images to files
+ **************************************************************************************************/
+
+#pragma once
+
+#include <filesystem>
+#include <vector>
+
+#include "maths/vec3.hpp"
+
+/**
+ * @brief Writes an image to a binary PPM (P6) file. Colors are clamped between 0 and 1.
+ * @param path The path of the file.
+ * @param width The width of the image in pixels.
+ * @param height The height of the image in pixels.
+ * @param pixels The pixels of the image, row by row from the top left corner.
+ */
+void writePPM(const std::filesystem::path& path,
+              unsigned int width, unsigned int height,
+              const std::vector<Color>& pixels);
+
+/**
+ * @brief Writes an image to a PNG file. Colors are clamped between 0 and 1. The image data is
+ * stored without compression so no external library is needed.
+ * @param path The path of the file.
+ * @param width The width of the image in pixels.
+ * @param height The height of the image in pixels.
+ * @param pixels The pixels of the image, row by row from the top left corner.
+ */
+void writePNG(const std::filesystem::path& path,
+              unsigned int width, unsigned int height,
+              const std::vector<Color>& pixels);
+
+/**
+ * @brief Writes an image to a file whose format is chosen from the extension of the path, which
+ * must be either ".ppm" or ".png".
+ * @param path The path of the file.
+ * @param width The width of the image in pixels.
+ * @param height The height of the image in pixels.
+ * @param pixels The pixels of the image, row by row from the top left corner.
+ */
+void writeImage(const std::filesystem::path& path,
+                unsigned int width, unsigned int height,
+                const std::vector<Color>& pixels);
@@ -1,21 +1,31 @@
 /***************************************************************************************************
  * @file  Matrix4.hpp
- * @brief Declaration of the Matrix4 struct
+ * @brief Declaration and implementation of the Matrix4 struct
  **************************************************************************************************/
 
 #pragma once
 
 #include <ostream>
 
+// Defining MATHS_NO_SIMD keeps the scalar paths, which the benchmarks compare with the SSE ones
+#if defined(__SSE__) && !defined(MATHS_NO_SIMD)
+#include <xmmintrin.h>
+#endif
+
 /**
  * @struct Matrix4
- * @brief Represents a 4 by 4 matrix.
+ * @brief Represents a 4 by 4 matrix, stored row by row. The rows are aligned on 16 bytes so that
+ * each of them is loaded in one SSE register.
  */
-struct Matrix4 {
+struct alignas(16) Matrix4 {
     /**
      * @brief Constructs a Matrix4 with all components equal to 0.
      */
-    Matrix4();
+    constexpr Matrix4() noexcept
+        : values{{0.0f, 0.0f, 0.0f, 0.0f},
+                 {0.0f, 0.0f, 0.0f, 0.0f},
+                 {0.0f, 0.0f, 0.0f, 0.0f},
+                 {0.0f, 0.0f, 0.0f, 0.0f}} { }
 
     /**
      * @brief Constructs a Matrix4 with a specific value for each component.
@@ -24,10 +34,14 @@ struct Matrix4 {
      * @param v20, v21, v22, v23 The values of the components of the third row.
      * @param v30, v31, v32, v33 The values of the components of the fourth row.
      */
-    Matrix4(float v00, float v01, float v02, float v03,
-            float v10, float v11, float v12, float v13,
-            float v20, float v21, float v22, float v23,
-            float v30, float v31, float v32, float v33);
+    constexpr Matrix4(float v00, float v01, float v02, float v03,
+                      float v10, float v11, float v12, float v13,
+                      float v20, float v21, float v22, float v23,
+                      float v30, float v31, float v32, float v33) noexcept
+        : values{{v00, v01, v02, v03},
+                 {v10, v11, v12, v13},
+                 {v20, v21, v22, v23},
+                 {v30, v31, v32, v33}} { }
 
     /**
      * @brief Constructs a Matrix4 with a specific value for each component of the 3 first columns
@@ -36,86 +50,154 @@ struct Matrix4 {
      * @param v10, v11, v12 The values of the first three components of the second row.
      * @param v20, v21, v22 The values of the first three components of the third row.
      */
-    Matrix4(float v00, float v01, float v02,
-            float v10, float v11, float v12,
-            float v20, float v21, float v22);
+    constexpr Matrix4(float v00, float v01, float v02,
+                      float v10, float v11, float v12,
+                      float v20, float v21, float v22) noexcept
+        : values{{v00,  v01,  v02,  0.0f},
+                 {v10,  v11,  v12,  0.0f},
+                 {v20,  v21,  v22,  0.0f},
+                 {0.0f, 0.0f, 0.0f, 1.0f}} { }
 
     /**
      * @brief Constructs a Matrix4 which is the identity matrix multiplied by a scalar.
      * Each value of the diagonal is equal to the scalar and the rest is zeros.
      * @param scalar The value for the components on the diagonal.
      */
-    Matrix4(float scalar);
+    constexpr Matrix4(float scalar) noexcept
+        : values{{scalar, 0.0f,   0.0f,   0.0f},
+                 {0.0f,   scalar, 0.0f,   0.0f},
+                 {0.0f,   0.0f,   scalar, 0.0f},
+                 {0.0f,   0.0f,   0.0f,   scalar}} { }
 
     /**
      * @brief Accesses a row in the underlying 2D array of values.
      * @param row The row's index.
      * @return The row with the given index.
      */
-    float* operator [](int row);
+    [[nodiscard]] constexpr float* operator [](int row) noexcept {
+        return values[row];
+    }
 
     /**
      * @brief Accesses a row in the underlying 2D array of values.
      * @param row The row's index.
      * @return The row with the given index.
      */
-    const float* operator [](int row) const;
+    [[nodiscard]] constexpr const float* operator [](int row) const noexcept {
+        return values[row];
+    }
 
     /**
      * @brief Adds another Matrix4's components to the current instance's components.
      * @param mat The Matrix4 to add.
      * @return A reference to this instance.
      */
-    Matrix4& operator +=(const Matrix4& mat);
+    constexpr Matrix4& operator +=(const Matrix4& mat) noexcept {
+        for(int i = 0 ; i < 4 ; ++i) {
+            for(int j = 0 ; j < 4 ; ++j) {
+                values[i][j] += mat[i][j];
+            }
+        }
+
+        return *this;
+    }
 
     /**
      * @brief Subtracts the current instance's components by another Matrix4's components.
      * @param mat The Matrix4 to subtract by.
      * @return A reference to this instance.
      */
-    Matrix4& operator -=(const Matrix4& mat);
+    constexpr Matrix4& operator -=(const Matrix4& mat) noexcept {
+        for(int i = 0 ; i < 4 ; ++i) {
+            for(int j = 0 ; j < 4 ; ++j) {
+                values[i][j] -= mat[i][j];
+            }
+        }
+
+        return *this;
+    }
 
     /**
      * @brief Multiplies the current instance's components by another Matrix4's components.
      * @param mat The Matrix4 to multiply by.
      * @return A reference to this instance.
      */
-    Matrix4& operator *=(const Matrix4& mat);
+    constexpr Matrix4& operator *=(const Matrix4& mat) noexcept;
 
     /**
      * @brief Divides the current instance's components by another Matrix4's components.
      * @param mat The Matrix4 to divide by.
      * @return A reference to this instance.
      */
-    Matrix4& operator /=(const Matrix4& mat);
+    constexpr Matrix4& operator /=(const Matrix4& mat) noexcept {
+        for(int i = 0 ; i < 4 ; ++i) {
+            for(int j = 0 ; j < 4 ; ++j) {
+                values[i][j] /= mat[i][j];
+            }
+        }
+
+        return *this;
+    }
 
     /**
      * @brief Adds a scalar to all of the current instance's components.
      * @param scalar The scalar to add.
      * @return A reference to this instance.
      */
-    Matrix4& operator +=(float scalar);
+    constexpr Matrix4& operator +=(float scalar) noexcept {
+        for(int i = 0 ; i < 4 ; ++i) {
+            for(int j = 0 ; j < 4 ; ++j) {
+                values[i][j] += scalar;
+            }
+        }
+
+        return *this;
+    }
 
     /**
      * @brief Subtracts all of the current instance's components by a scalar.
      * @param scalar The scalar to subtract by.
      * @return A reference to this instance.
      */
-    Matrix4& operator -=(float scalar);
+    constexpr Matrix4& operator -=(float scalar) noexcept {
+        for(int i = 0 ; i < 4 ; ++i) {
+            for(int j = 0 ; j < 4 ; ++j) {
+                values[i][j] -= scalar;
+            }
+        }
+
+        return *this;
+    }
 
     /**
      * @brief Multiplies all of the current instance's components by a scalar.
      * @param scalar The scalar to multiply by.
      * @return A reference to this instance.
      */
-    Matrix4& operator *=(float scalar);
+    constexpr Matrix4& operator *=(float scalar) noexcept {
+        for(int i = 0 ; i < 4 ; ++i) {
+            for(int j = 0 ; j < 4 ; ++j) {
+                values[i][j] *= scalar;
+            }
+        }
+
+        return *this;
+    }
 
     /**
      * @brief Divides all of the current instance's components by a scalar.
      * @param scalar The scalar to divide by.
      * @return A reference to this instance.
      */
-    Matrix4& operator /=(float scalar);
+    constexpr Matrix4& operator /=(float scalar) noexcept {
+        for(int i = 0 ; i < 4 ; ++i) {
+            for(int j = 0 ; j < 4 ; ++j) {
+                values[i][j] /= scalar;
+            }
+        }
+
+        return *this;
+    }
 
     float values[4][4]; ///< The values of the matrix.
 };
@@ -130,60 +212,443 @@ struct Matrix4 {
  * @param Matrix The Matrix4 to write to the stream.
  * @return A reference to the output stream after writing the Matrix4.
  */
-std::ostream& operator <<(std::ostream& stream, const Matrix4& mat);
+inline std::ostream& operator <<(std::ostream& stream, const Matrix4& mat) {
+    for(int i = 0 ; i < 4 ; ++i) {
+        stream << "( ";
+
+        for(int j = 0 ; j < 3 ; ++j) {
+            stream << ' ' << mat[i][j] << " ; ";
+        }
+
+        stream << mat[i][3] << " )\n";
+    }
+    return stream;
+}
 
 /** @brief Adds a Matrix4's components to another's.
  *  @param left The left operand.
  *  @param right The right operand.
  *  @return The component-wise sum of the two Matrix4.
  */
-Matrix4 operator +(const Matrix4& left, const Matrix4& right);
+[[nodiscard]] constexpr Matrix4 operator +(const Matrix4& left, const Matrix4& right) noexcept {
+    Matrix4 result;
+
+    for(int i = 0 ; i < 4 ; ++i) {
+        for(int j = 0 ; j < 4 ; ++j) {
+            result[i][j] = left[i][j] + right[i][j];
+        }
+    }
+
+    return result;
+}
 
 /** @brief Subtracts a Matrix4's components by another's.
  *  @param left The left operand.
  *  @param right The right operand.
  *  @return The component-wise subtraction of the first Matrix4 by the second.
  */
-Matrix4 operator -(const Matrix4& left, const Matrix4& right);
+[[nodiscard]] constexpr Matrix4 operator -(const Matrix4& left, const Matrix4& right) noexcept {
+    Matrix4 result;
+
+    for(int i = 0 ; i < 4 ; ++i) {
+        for(int j = 0 ; j < 4 ; ++j) {
+            result[i][j] = left[i][j] - right[i][j];
+        }
+    }
+
+    return result;
+}
 
 /** @brief Multiplies a Matrix4 by another.
  *  @param left The left operand.
  *  @param right The right operand.
  *  @return The product of the two Matrix4.
  */
-Matrix4 operator *(const Matrix4& left, const Matrix4& right);
+[[nodiscard]] constexpr Matrix4 operator *(const Matrix4& left, const Matrix4& right) noexcept {
+    Matrix4 result;
+
+#if defined(__SSE__) && !defined(MATHS_NO_SIMD)
+    if !consteval {
+        // Each row of the product is a combination of the rows of the right operand
+        const __m128 row0 = _mm_load_ps(right[0]);
+        const __m128 row1 = _mm_load_ps(right[1]);
+        const __m128 row2 = _mm_load_ps(right[2]);
+        const __m128 row3 = _mm_load_ps(right[3]);
+
+        for(int i = 0 ; i < 4 ; ++i) {
+            const __m128 row = _mm_load_ps(left[i]);
+            const __m128 x = _mm_shuffle_ps(row, row, _MM_SHUFFLE(0, 0, 0, 0));
+            const __m128 y = _mm_shuffle_ps(row, row, _MM_SHUFFLE(1, 1, 1, 1));
+            const __m128 z = _mm_shuffle_ps(row, row, _MM_SHUFFLE(2, 2, 2, 2));
+            const __m128 w = _mm_shuffle_ps(row, row, _MM_SHUFFLE(3, 3, 3, 3));
+
+            _mm_store_ps(result[i], _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(x, row0), _mm_mul_ps(y, row1)),
+                _mm_add_ps(_mm_mul_ps(z, row2), _mm_mul_ps(w, row3))
+            ));
+        }
+
+        return result;
+    }
+#endif
+
+    for(int i = 0 ; i < 4 ; ++i) {
+        for(int j = 0 ; j < 4 ; ++j) {
+            result[i][j] = left[i][0] * right[0][j] + left[i][1] * right[1][j]
+                           + left[i][2] * right[2][j] + left[i][3] * right[3][j];
+        }
+    }
+
+    return result;
+}
 
 /** @brief Adds a scalar to each of a Matrix4's components.
  *  @param Matrix The Matrix4.
  *  @param scalar The scalar.
  *  @return The component-wise sum of a Matrix4 by a scalar.
  */
-Matrix4 operator +(const Matrix4& mat, float scalar);
+[[nodiscard]] constexpr Matrix4 operator +(const Matrix4& mat, float scalar) noexcept {
+    Matrix4 result;
+
+    for(int i = 0 ; i < 4 ; ++i) {
+        for(int j = 0 ; j < 4 ; ++j) {
+            result[i][j] = mat[i][j] + scalar;
+        }
+    }
+
+    return result;
+}
 
 /** @brief Subtracts each of a Matrix4's components by a scalar.
  *  @param Matrix The Matrix4.
  *  @param scalar The scalar.
  *  @return The component-wise subtraction of a Matrix4 by a scalar.
  */
-Matrix4 operator -(const Matrix4& mat, float scalar);
+[[nodiscard]] constexpr Matrix4 operator -(const Matrix4& mat, float scalar) noexcept {
+    Matrix4 result;
+
+    for(int i = 0 ; i < 4 ; ++i) {
+        for(int j = 0 ; j < 4 ; ++j) {
+            result[i][j] = mat[i][j] - scalar;
+        }
+    }
+
+    return result;
+}
 
 /** @brief Multiplies each of a Matrix4's components by a scalar.
  *  @param Matrix The Matrix4.
  *  @param scalar The scalar.
  *  @return The component-wise product of a Matrix4 by a scalar.
  */
-Matrix4 operator *(const Matrix4& mat, float scalar);
+[[nodiscard]] constexpr Matrix4 operator *(const Matrix4& mat, float scalar) noexcept {
+    Matrix4 result;
+
+    for(int i = 0 ; i < 4 ; ++i) {
+        for(int j = 0 ; j < 4 ; ++j) {
+            result[i][j] = mat[i][j] * scalar;
+        }
+    }
+
+    return result;
+}
 
 /** @brief Multiplies each of a Matrix4's components by a scalar.
  *  @param scalar The scalar.
  *  @param Matrix The Matrix4.
  *  @return The component-wise product of a Matrix4 by a scalar.
  */
-Matrix4 operator *(float scalar, const Matrix4& mat);
+[[nodiscard]] constexpr Matrix4 operator *(float scalar, const Matrix4& mat) noexcept {
+    Matrix4 result;
+
+    for(int i = 0 ; i < 4 ; ++i) {
+        for(int j = 0 ; j < 4 ; ++j) {
+            result[i][j] = scalar * mat[i][j];
+        }
+    }
+
+    return result;
+}
 
 /** @brief Divides each of a Matrix4's components by a scalar.
  *  @param Matrix The Matrix4.
  *  @param scalar The scalar.
  *  @return The component-wise division of a Matrix4 by a scalar.
  */
-Matrix4 operator /(const Matrix4& mat, float scalar);
\ No newline at end of file
+[[nodiscard]] constexpr Matrix4 operator /(const Matrix4& mat, float scalar) noexcept {
+    Matrix4 result;
+
+    for(int i = 0 ; i < 4 ; ++i) {
+        for(int j = 0 ; j < 4 ; ++j) {
+            result[i][j] = mat[i][j] / scalar;
+        }
+    }
+
+    return result;
+}
+
+// Defined after the product of two Matrix4, which it uses
+constexpr Matrix4& Matrix4::operator *=(const Matrix4& mat) noexcept {
+    *this = *this * mat;
+
+    return *this;
+}
+
+/**
+ * @brief Calculates the transpose of a Matrix4, whose rows are the columns of the Matrix4.
+ * @param mat The Matrix4.
+ * @return The transpose of the Matrix4.
+ */
+[[nodiscard]] constexpr Matrix4 transpose(const Matrix4& mat) noexcept {
+    Matrix4 result;
+
+#if defined(__SSE__) && !defined(MATHS_NO_SIMD)
+    if !consteval {
+        __m128 row0 = _mm_load_ps(mat[0]);
+        __m128 row1 = _mm_load_ps(mat[1]);
+        __m128 row2 = _mm_load_ps(mat[2]);
+        __m128 row3 = _mm_load_ps(mat[3]);
+
+        _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+        _mm_store_ps(result[0], row0);
+        _mm_store_ps(result[1], row1);
+        _mm_store_ps(result[2], row2);
+        _mm_store_ps(result[3], row3);
+
+        return result;
+    }
+#endif
+
+    for(int i = 0 ; i < 4 ; ++i) {
+        for(int j = 0 ; j < 4 ; ++j) {
+            result[i][j] = mat[j][i];
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Calculates the inverse of any invertible Matrix4. The inverse of a transformation that
+ * keeps the fourth row of the identity is cheaper to calculate with affineInverse.
+ * @param mat The Matrix4, whose determinant isn't 0.
+ * @return The inverse of the Matrix4.
+ */
+[[nodiscard]] constexpr Matrix4 inverse(const Matrix4& mat) noexcept {
+    Matrix4 result;
+
+#if defined(__SSE__) && !defined(MATHS_NO_SIMD)
+    if !consteval {
+        // The matrix is split in 4 blocks of 2x2 (A B ; C D), each stored row by row in a register
+        // and inverted with their adjugates (A#...) and determinants (|A|...)
+        const __m128 row0 = _mm_load_ps(mat[0]);
+        const __m128 row1 = _mm_load_ps(mat[1]);
+        const __m128 row2 = _mm_load_ps(mat[2]);
+        const __m128 row3 = _mm_load_ps(mat[3]);
+
+        const __m128 A = _mm_movelh_ps(row0, row1);
+        const __m128 B = _mm_movehl_ps(row1, row0);
+        const __m128 C = _mm_movelh_ps(row2, row3);
+        const __m128 D = _mm_movehl_ps(row3, row2);
+
+        // Products of 2x2 blocks: X * Y, X# * Y and X * Y#
+        const auto multiply = [](__m128 X, __m128 Y) {
+            return _mm_add_ps(
+                _mm_mul_ps(X, _mm_shuffle_ps(Y, Y, _MM_SHUFFLE(3, 0, 3, 0))),
+                _mm_mul_ps(_mm_shuffle_ps(X, X, _MM_SHUFFLE(2, 3, 0, 1)),
+                           _mm_shuffle_ps(Y, Y, _MM_SHUFFLE(1, 2, 1, 2)))
+            );
+        };
+        const auto adjugateMultiply = [](__m128 X, __m128 Y) {
+            return _mm_sub_ps(
+                _mm_mul_ps(_mm_shuffle_ps(X, X, _MM_SHUFFLE(0, 0, 3, 3)), Y),
+                _mm_mul_ps(_mm_shuffle_ps(X, X, _MM_SHUFFLE(2, 2, 1, 1)),
+                           _mm_shuffle_ps(Y, Y, _MM_SHUFFLE(1, 0, 3, 2)))
+            );
+        };
+        const auto multiplyAdjugate = [](__m128 X, __m128 Y) {
+            return _mm_sub_ps(
+                _mm_mul_ps(X, _mm_shuffle_ps(Y, Y, _MM_SHUFFLE(0, 3, 0, 3))),
+                _mm_mul_ps(_mm_shuffle_ps(X, X, _MM_SHUFFLE(2, 3, 0, 1)),
+                           _mm_shuffle_ps(Y, Y, _MM_SHUFFLE(1, 2, 1, 2)))
+            );
+        };
+
+        // (|A| |B| |C| |D|)
+        const __m128 determinants = _mm_sub_ps(
+            _mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(2, 0, 2, 0)),
+                       _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(3, 1, 3, 1))),
+            _mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(3, 1, 3, 1)),
+                       _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(2, 0, 2, 0)))
+        );
+        const __m128 detA = _mm_shuffle_ps(determinants, determinants, _MM_SHUFFLE(0, 0, 0, 0));
+        const __m128 detB = _mm_shuffle_ps(determinants, determinants, _MM_SHUFFLE(1, 1, 1, 1));
+        const __m128 detC = _mm_shuffle_ps(determinants, determinants, _MM_SHUFFLE(2, 2, 2, 2));
+        const __m128 detD = _mm_shuffle_ps(determinants, determinants, _MM_SHUFFLE(3, 3, 3, 3));
+
+        const __m128 DC = adjugateMultiply(D, C);
+        const __m128 AB = adjugateMultiply(A, B);
+
+        // The inverse is (X Y ; Z W) / |M|, the blocks are first calculated as their adjugates
+        __m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), multiply(B, DC));
+        __m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), multiply(C, AB));
+        __m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), multiplyAdjugate(D, AB));
+        __m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), multiplyAdjugate(A, DC));
+
+        // |M| = |A| |D| + |B| |C| - tr(A#B D#C)
+        __m128 trace = _mm_mul_ps(AB, _mm_shuffle_ps(DC, DC, _MM_SHUFFLE(3, 1, 2, 0)));
+        trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(1, 0, 3, 2)));
+        trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(2, 3, 0, 1)));
+
+        const __m128 determinant = _mm_sub_ps(
+            _mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)),
+            trace
+        );
+
+        // The signs of the adjugates are applied with the division
+        const __m128 factor = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant);
+        X = _mm_mul_ps(X, factor);
+        Y = _mm_mul_ps(Y, factor);
+        Z = _mm_mul_ps(Z, factor);
+        W = _mm_mul_ps(W, factor);
+
+        // The remaining swaps of the adjugates are combined with the reassembly of the rows
+        _mm_store_ps(result[0], _mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3)));
+        _mm_store_ps(result[1], _mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2)));
+        _mm_store_ps(result[2], _mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3)));
+        _mm_store_ps(result[3], _mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2)));
+
+        return result;
+    }
+#endif
+
+    // Determinants of the 2x2 blocks of the two first and two last rows
+    const float s0 = mat[0][0] * mat[1][1] - mat[1][0] * mat[0][1];
+    const float s1 = mat[0][0] * mat[1][2] - mat[1][0] * mat[0][2];
+    const float s2 = mat[0][0] * mat[1][3] - mat[1][0] * mat[0][3];
+    const float s3 = mat[0][1] * mat[1][2] - mat[1][1] * mat[0][2];
+    const float s4 = mat[0][1] * mat[1][3] - mat[1][1] * mat[0][3];
+    const float s5 = mat[0][2] * mat[1][3] - mat[1][2] * mat[0][3];
+
+    const float c0 = mat[2][0] * mat[3][1] - mat[3][0] * mat[2][1];
+    const float c1 = mat[2][0] * mat[3][2] - mat[3][0] * mat[2][2];
+    const float c2 = mat[2][0] * mat[3][3] - mat[3][0] * mat[2][3];
+    const float c3 = mat[2][1] * mat[3][2] - mat[3][1] * mat[2][2];
+    const float c4 = mat[2][1] * mat[3][3] - mat[3][1] * mat[2][3];
+    const float c5 = mat[2][2] * mat[3][3] - mat[3][2] * mat[2][3];
+
+    const float factor = 1.0f / (s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0);
+
+    result[0][0] = ( mat[1][1] * c5 - mat[1][2] * c4 + mat[1][3] * c3) * factor;
+    result[0][1] = (-mat[0][1] * c5 + mat[0][2] * c4 - mat[0][3] * c3) * factor;
+    result[0][2] = ( mat[3][1] * s5 - mat[3][2] * s4 + mat[3][3] * s3) * factor;
+    result[0][3] = (-mat[2][1] * s5 + mat[2][2] * s4 - mat[2][3] * s3) * factor;
+
+    result[1][0] = (-mat[1][0] * c5 + mat[1][2] * c2 - mat[1][3] * c1) * factor;
+    result[1][1] = ( mat[0][0] * c5 - mat[0][2] * c2 + mat[0][3] * c1) * factor;
+    result[1][2] = (-mat[3][0] * s5 + mat[3][2] * s2 - mat[3][3] * s1) * factor;
+    result[1][3] = ( mat[2][0] * s5 - mat[2][2] * s2 + mat[2][3] * s1) * factor;
+
+    result[2][0] = ( mat[1][0] * c4 - mat[1][1] * c2 + mat[1][3] * c0) * factor;
+    result[2][1] = (-mat[0][0] * c4 + mat[0][1] * c2 - mat[0][3] * c0) * factor;
+    result[2][2] = ( mat[3][0] * s4 - mat[3][1] * s2 + mat[3][3] * s0) * factor;
+    result[2][3] = (-mat[2][0] * s4 + mat[2][1] * s2 - mat[2][3] * s0) * factor;
+
+    result[3][0] = (-mat[1][0] * c3 + mat[1][1] * c1 - mat[1][2] * c0) * factor;
+    result[3][1] = ( mat[0][0] * c3 - mat[0][1] * c1 + mat[0][2] * c0) * factor;
+    result[3][2] = (-mat[3][0] * s3 + mat[3][1] * s1 - mat[3][2] * s0) * factor;
+    result[3][3] = ( mat[2][0] * s3 - mat[2][1] * s1 + mat[2][2] * s0) * factor;
+
+    return result;
+}
+
+/**
+ * @brief Calculates the inverse of an affine transformation, a Matrix4 whose fourth row is the
+ * same as the identity's, like the products of scalings, rotations and translations.
+ * @param mat The Matrix4, whose top left 3x3 block has a determinant that isn't 0.
+ * @return The inverse of the Matrix4.
+ */
+[[nodiscard]] constexpr Matrix4 affineInverse(const Matrix4& mat) noexcept {
+    // The inverse of the 3x3 block's rows a, b and c has b x c, c x a and a x b as columns,
+    // divided by the determinant. The translation t is then undone with -inverse * t.
+#if defined(__SSE__) && !defined(MATHS_NO_SIMD)
+    if !consteval {
+        const auto cross = [](__m128 u, __m128 v) {
+            return _mm_sub_ps(
+                _mm_mul_ps(_mm_shuffle_ps(u, u, _MM_SHUFFLE(3, 0, 2, 1)),
+                           _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 1, 0, 2))),
+                _mm_mul_ps(_mm_shuffle_ps(u, u, _MM_SHUFFLE(3, 1, 0, 2)),
+                           _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 0, 2, 1)))
+            );
+        };
+
+        // The fourth lanes hold the translation, which the cross products cancel out
+        const __m128 a = _mm_load_ps(mat[0]);
+        const __m128 b = _mm_load_ps(mat[1]);
+        const __m128 c = _mm_load_ps(mat[2]);
+
+        __m128 column0 = cross(b, c);
+        __m128 column1 = cross(c, a);
+        __m128 column2 = cross(a, b);
+
+        // a . (b x c), summed in the first lane
+        const __m128 products = _mm_mul_ps(a, column0);
+        const __m128 determinant = _mm_add_ps(
+            _mm_add_ps(products, _mm_shuffle_ps(products, products, _MM_SHUFFLE(0, 0, 0, 1))),
+            _mm_shuffle_ps(products, products, _MM_SHUFFLE(0, 0, 0, 2))
+        );
+        const __m128 factor = _mm_div_ps(
+            _mm_set1_ps(1.0f),
+            _mm_shuffle_ps(determinant, determinant, _MM_SHUFFLE(0, 0, 0, 0))
+        );
+
+        column0 = _mm_mul_ps(column0, factor);
+        column1 = _mm_mul_ps(column1, factor);
+        column2 = _mm_mul_ps(column2, factor);
+
+        __m128 translation = _mm_mul_ps(column0, _mm_set1_ps(-mat[0][3]));
+        translation = _mm_sub_ps(translation, _mm_mul_ps(column1, _mm_set1_ps(mat[1][3])));
+        translation = _mm_sub_ps(translation, _mm_mul_ps(column2, _mm_set1_ps(mat[2][3])));
+
+        __m128 row3 = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+        _MM_TRANSPOSE4_PS(column0, column1, column2, translation);
+
+        Matrix4 result;
+        _mm_store_ps(result[0], column0);
+        _mm_store_ps(result[1], column1);
+        _mm_store_ps(result[2], column2);
+        _mm_store_ps(result[3], row3);
+
+        return result;
+    }
+#endif
+
+    const float columns[3][3] {
+        {mat[1][1] * mat[2][2] - mat[1][2] * mat[2][1],
+         mat[1][2] * mat[2][0] - mat[1][0] * mat[2][2],
+         mat[1][0] * mat[2][1] - mat[1][1] * mat[2][0]},
+        {mat[2][1] * mat[0][2] - mat[2][2] * mat[0][1],
+         mat[2][2] * mat[0][0] - mat[2][0] * mat[0][2],
+         mat[2][0] * mat[0][1] - mat[2][1] * mat[0][0]},
+        {mat[0][1] * mat[1][2] - mat[0][2] * mat[1][1],
+         mat[0][2] * mat[1][0] - mat[0][0] * mat[1][2],
+         mat[0][0] * mat[1][1] - mat[0][1] * mat[1][0]}
+    };
+
+    const float factor = 1.0f / (mat[0][0] * columns[0][0] + mat[0][1] * columns[0][1]
+                                 + mat[0][2] * columns[0][2]);
+
+    Matrix4 result(1.0f);
+
+    for(int i = 0 ; i < 3 ; ++i) {
+        for(int j = 0 ; j < 3 ; ++j) {
+            result[i][j] = columns[j][i] * factor;
+        }
+
+        result[i][3] = -(result[i][0] * mat[0][3] + result[i][1] * mat[1][3]
+                         + result[i][2] * mat[2][3]);
+    }
+
+    return result;
+}
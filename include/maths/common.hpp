@@ -0,0 +1,194 @@
+/***************************************************************************************************
+ * @file  common.hpp
+ * @brief Declaration and implementation of component-wise functions mirroring GLSL's common
+ * functions
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cmath>
+
+#include "vec2.hpp"
+#include "vec3.hpp"
+
+/**
+ * @brief Calculates the fractional part of a scalar, i.e. x - floor(x).
+ * @param scalar The scalar.
+ * @return The fractional part.
+ */
+[[nodiscard]] constexpr float fract(float scalar) noexcept {
+    return scalar - floorf(scalar);
+}
+
+/**
+ * @brief Calculates the fractional part of each of a vec3's components.
+ * @param vec The vec3.
+ * @return The component-wise fractional part.
+ */
+[[nodiscard]] constexpr vec3 fract(const vec3& vec) noexcept {
+    return vec3(
+        vec.x - floorf(vec.x),
+        vec.y - floorf(vec.y),
+        vec.z - floorf(vec.z)
+    );
+}
+
+/**
+ * @brief Calculates x modulo y the same way GLSL does, i.e. x - y * floor(x / y). Unlike fmodf,
+ * the result always has the same sign as y.
+ * @param x The dividend.
+ * @param y The divisor.
+ * @return x modulo y.
+ */
+[[nodiscard]] constexpr float mod(float x, float y) noexcept {
+    return x - y * floorf(x / y);
+}
+
+/**
+ * @brief Calculates each of a vec2's components modulo a scalar.
+ * @param vec The vec2.
+ * @param scalar The divisor.
+ * @return The component-wise modulo.
+ */
+[[nodiscard]] constexpr vec2 mod(const vec2& vec, float scalar) noexcept {
+    return vec2(
+        mod(vec.x, scalar),
+        mod(vec.y, scalar)
+    );
+}
+
+/**
+ * @brief Calculates each of a vec3's components modulo a scalar.
+ * @param vec The vec3.
+ * @param scalar The divisor.
+ * @return The component-wise modulo.
+ */
+[[nodiscard]] constexpr vec3 mod(const vec3& vec, float scalar) noexcept {
+    return vec3(
+        mod(vec.x, scalar),
+        mod(vec.y, scalar),
+        mod(vec.z, scalar)
+    );
+}
+
+/**
+ * @brief Constrains a scalar to lie between two values.
+ * @param scalar The scalar.
+ * @param min The lower bound.
+ * @param max The upper bound.
+ * @return The clamped scalar.
+ */
+[[nodiscard]] constexpr float clamp(float scalar, float min, float max) noexcept {
+    return fminf(fmaxf(scalar, min), max);
+}
+
+/**
+ * @brief Constrains each of a vec3's components to lie between two values.
+ * @param vec The vec3.
+ * @param min The lower bound.
+ * @param max The upper bound.
+ * @return The component-wise clamped vec3.
+ */
+[[nodiscard]] constexpr vec3 clamp(const vec3& vec, float min, float max) noexcept {
+    return vec3(
+        clamp(vec.x, min, max),
+        clamp(vec.y, min, max),
+        clamp(vec.z, min, max)
+    );
+}
+
+/**
+ * @brief Linearly interpolates between two scalars.
+ * @param a The value returned when t is 0.
+ * @param b The value returned when t is 1.
+ * @param t The interpolation factor.
+ * @return a * (1 - t) + b * t.
+ */
+[[nodiscard]] constexpr float mix(float a, float b, float t) noexcept {
+    return a + (b - a) * t;
+}
+
+/**
+ * @brief Linearly interpolates between two vec3.
+ * @param a The value returned when t is 0.
+ * @param b The value returned when t is 1.
+ * @param t The interpolation factor.
+ * @return a * (1 - t) + b * t.
+ */
+[[nodiscard]] constexpr vec3 mix(const vec3& a, const vec3& b, float t) noexcept {
+    return a + (b - a) * t;
+}
+
+/**
+ * @brief Extracts the sign of a scalar.
+ * @param scalar The scalar.
+ * @return -1 if the scalar is negative, 1 if it is positive and 0 otherwise.
+ */
+[[nodiscard]] constexpr float sign(float scalar) noexcept {
+    return scalar > 0.0f ? 1.0f : (scalar < 0.0f ? -1.0f : 0.0f);
+}
+
+/**
+ * @brief Calculates the absolute value of each of a vec2's components.
+ * @param vec The vec2.
+ * @return The component-wise absolute value.
+ */
+[[nodiscard]] constexpr vec2 abs(const vec2& vec) noexcept {
+    return vec2(
+        fabsf(vec.x),
+        fabsf(vec.y)
+    );
+}
+
+/**
+ * @brief Calculates the absolute value of each of a vec3's components.
+ * @param vec The vec3.
+ * @return The component-wise absolute value.
+ */
+[[nodiscard]] constexpr vec3 abs(const vec3& vec) noexcept {
+    return vec3(
+        fabsf(vec.x),
+        fabsf(vec.y),
+        fabsf(vec.z)
+    );
+}
+
+/**
+ * @brief Rounds each of a vec3's components to the nearest integer.
+ * @param vec The vec3.
+ * @return The component-wise rounded vec3.
+ */
+[[nodiscard]] constexpr vec3 round(const vec3& vec) noexcept {
+    return vec3(
+        roundf(vec.x),
+        roundf(vec.y),
+        roundf(vec.z)
+    );
+}
+
+/**
+ * @brief Calculates the maximum between each of a vec2's components and a scalar.
+ * @param vec The vec2.
+ * @param scalar The scalar.
+ * @return The component-wise maximum.
+ */
+[[nodiscard]] constexpr vec2 max(const vec2& vec, float scalar) noexcept {
+    return vec2(
+        fmaxf(vec.x, scalar),
+        fmaxf(vec.y, scalar)
+    );
+}
+
+/**
+ * @brief Calculates the maximum between each of a vec3's components and a scalar.
+ * @param vec The vec3.
+ * @param scalar The scalar.
+ * @return The component-wise maximum.
+ */
+[[nodiscard]] constexpr vec3 max(const vec3& vec, float scalar) noexcept {
+    return vec3(
+        fmaxf(vec.x, scalar),
+        fmaxf(vec.y, scalar),
+        fmaxf(vec.z, scalar)
+    );
+}
@@ -0,0 +1,208 @@
+/***************************************************************************************************
+ * @file  float8.hpp
+ * @brief Declaration and implementation of the float8 struct
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cmath>
+#include <iostream>
+
+// Defining MATHS_NO_SIMD keeps the scalar paths, which the benchmarks compare with the SSE ones
+#if defined(__SSE__) && !defined(MATHS_NO_SIMD)
+#include <xmmintrin.h>
+#endif
+
+/**
+ * @struct float8
+ * @brief Represents 8 floats processed together, the lanes of vec3x8. Unlike the floatx8 of the
+ * packet marcher, it doesn't depend on an instruction set: the compiler puts the lanes in one AVX
+ * register or in two SSE registers depending on the target.
+ */
+struct float8 {
+    static constexpr unsigned int SIZE = 8u; ///< The number of lanes.
+
+    /**
+     * @brief The GCC vector type the lanes are stored in, whose operators are lane-wise.
+     */
+    typedef float Lanes __attribute__((vector_size(SIZE * sizeof(float))));
+
+    /**
+     * @brief Constructs a float8 with all lanes equal to 0.
+     */
+    constexpr float8() noexcept : lanes{} { }
+
+    /**
+     * @brief Constructs a float8 with the same value in each lane.
+     * @param scalar The value of each lane.
+     */
+    constexpr float8(float scalar) noexcept : lanes(Lanes{} + scalar) { }
+
+    /**
+     * @brief Constructs a float8 from its lanes.
+     * @param lanes The lanes.
+     */
+    constexpr float8(const Lanes& lanes) noexcept : lanes(lanes) { }
+
+    /**
+     * @brief Reads 8 consecutive floats.
+     * @param values The floats, without alignment requirement.
+     * @return The float8 holding the floats in order.
+     */
+    [[nodiscard]] static constexpr float8 load(const float* values) noexcept {
+        // Single lanes can't be assigned in constant expressions, the vector is built at once
+        return float8(Lanes{
+            values[0], values[1], values[2], values[3], values[4], values[5], values[6], values[7]
+        });
+    }
+
+    /**
+     * @brief Writes the lanes to 8 consecutive floats.
+     * @param values The floats, without alignment requirement.
+     */
+    constexpr void store(float* values) const noexcept {
+        for(unsigned int lane = 0u ; lane < SIZE ; ++lane) {
+            values[lane] = lanes[lane];
+        }
+    }
+
+    /**
+     * @brief Gets the value of a lane.
+     * @param lane The index of the lane, less than SIZE.
+     * @return The value of the lane.
+     */
+    [[nodiscard]] constexpr float operator [](unsigned int lane) const noexcept {
+        return lanes[lane];
+    }
+
+    /**
+     * @brief Adds another float8's lanes to the current instance's lanes.
+     * @param value The float8 to add.
+     * @return A reference to this instance.
+     */
+    constexpr float8& operator +=(const float8& value) noexcept {
+        lanes += value.lanes;
+        return *this;
+    }
+
+    /**
+     * @brief Subtracts the current instance's lanes by another float8's lanes.
+     * @param value The float8 to subtract by.
+     * @return A reference to this instance.
+     */
+    constexpr float8& operator -=(const float8& value) noexcept {
+        lanes -= value.lanes;
+        return *this;
+    }
+
+    /**
+     * @brief Multiplies the current instance's lanes by another float8's lanes.
+     * @param value The float8 to multiply by.
+     * @return A reference to this instance.
+     */
+    constexpr float8& operator *=(const float8& value) noexcept {
+        lanes *= value.lanes;
+        return *this;
+    }
+
+    /**
+     * @brief Divides the current instance's lanes by another float8's lanes.
+     * @param value The float8 to divide by.
+     * @return A reference to this instance.
+     */
+    constexpr float8& operator /=(const float8& value) noexcept {
+        lanes /= value.lanes;
+        return *this;
+    }
+
+    Lanes lanes; ///< The lanes, aligned on 32 bytes.
+};
+
+/**
+ * @brief Writes the lanes of the given float8 to the output stream in the format
+ * "( a ; b ; ... ; h )".
+ * @param stream The output stream to write to.
+ * @param value The float8 to write to the stream.
+ * @return A reference to the output stream after writing the float8.
+ */
+inline std::ostream& operator <<(std::ostream& stream, const float8& value) {
+    stream << "( " << value[0];
+    for(unsigned int lane = 1u ; lane < float8::SIZE ; ++lane) {
+        stream << " ; " << value[lane];
+    }
+    stream << " )";
+
+    return stream;
+}
+
+/** @brief Adds a float8's lanes to another's. Floats are broadcast to every lane.
+ *  @param left The left operand.
+ *  @param right The right operand.
+ *  @return The lane-wise sum of the two float8.
+ */
+[[nodiscard]] constexpr float8 operator +(const float8& left, const float8& right) noexcept {
+    return float8(left.lanes + right.lanes);
+}
+
+/** @brief Subtracts a float8's lanes by another's. Floats are broadcast to every lane.
+ *  @param left The left operand.
+ *  @param right The right operand.
+ *  @return The lane-wise subtraction of the first float8 by the second.
+ */
+[[nodiscard]] constexpr float8 operator -(const float8& left, const float8& right) noexcept {
+    return float8(left.lanes - right.lanes);
+}
+
+/** @brief Multiplies a float8's lanes by another's. Floats are broadcast to every lane.
+ *  @param left The left operand.
+ *  @param right The right operand.
+ *  @return The lane-wise product of the two float8.
+ */
+[[nodiscard]] constexpr float8 operator *(const float8& left, const float8& right) noexcept {
+    return float8(left.lanes * right.lanes);
+}
+
+/** @brief Divides a float8's lanes by another's. Floats are broadcast to every lane.
+ *  @param left The left operand.
+ *  @param right The right operand.
+ *  @return The lane-wise division of the first float8 by the second.
+ */
+[[nodiscard]] constexpr float8 operator /(const float8& left, const float8& right) noexcept {
+    return float8(left.lanes / right.lanes);
+}
+
+/** @brief Negates each of a float8's lanes.
+ *  @param value The float8.
+ *  @return The lane-wise negation of the float8.
+ */
+[[nodiscard]] constexpr float8 operator -(const float8& value) noexcept {
+    return float8(-value.lanes);
+}
+
+/**
+ * @brief Calculates the square root of each lane of a float8.
+ * @param value The float8.
+ * @return The lane-wise square root.
+ */
+[[nodiscard]] constexpr float8 sqrt(const float8& value) noexcept {
+#if defined(__SSE__) && !defined(MATHS_NO_SIMD)
+    if !consteval {
+        // Vector extensions have no square root, the lanes are split between two SSE registers
+        float8 result;
+        const __m128* halves = reinterpret_cast<const __m128*>(&value.lanes);
+        __m128* resultHalves = reinterpret_cast<__m128*>(&result.lanes);
+
+        resultHalves[0] = _mm_sqrt_ps(halves[0]);
+        resultHalves[1] = _mm_sqrt_ps(halves[1]);
+
+        return result;
+    }
+#endif
+
+    float roots[float8::SIZE] {};
+    for(unsigned int lane = 0u ; lane < float8::SIZE ; ++lane) {
+        roots[lane] = sqrtf(value[lane]);
+    }
+
+    return float8::load(roots);
+}
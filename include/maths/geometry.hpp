@@ -1,34 +1,16 @@
 /***************************************************************************************************
  * @file  geometry.hpp
- * @brief Declaration of some functions regarding vector maths
+ * @brief Declaration and implementation of some functions regarding vector maths
  **************************************************************************************************/
 
 #pragma once
 
+#include <cmath>
+
 #include "vec2.hpp"
 #include "vec3.hpp"
 #include "vec4.hpp"
-
-/**
- * @brief Calculates the length of a vec2.
- * @param vec The vec2.
- * @return The length.
- */
-float length(const vec2& vec);
-
-/**
- * @brief Calculates the length of a vec3.
- * @param vec The vec3.
- * @return The length.
- */
-float length(const vec3& vec);
-
-/**
- * @brief Calculates the length of a vec4.
- * @param vec The vec4.
- * @return The length.
- */
-float length(const vec4& vec);
+#include "vec3x8.hpp"
 
 /**
  * @brief Calculates the dot product of two vec2.
@@ -36,7 +18,9 @@ float length(const vec4& vec);
  * @param right The right operand.
  * @return The dot product of the two vec2.
  */
-float dot(const vec2& left, const vec2& right);
+[[nodiscard]] constexpr float dot(const vec2& left, const vec2& right) noexcept {
+    return left.x * right.x + left.y * right.y;
+}
 
 /**
  * @brief Calculates the dot product of two vec3.
@@ -44,7 +28,19 @@ float dot(const vec2& left, const vec2& right);
  * @param right The right operand.
  * @return The dot product of the two vec3.
  */
-float dot(const vec3& left, const vec3& right);
+[[nodiscard]] constexpr float dot(const vec3& left, const vec3& right) noexcept {
+    return left.x * right.x + left.y * right.y + left.z * right.z;
+}
+
+/**
+ * @brief Calculates the dot products of the vectors of two vec3x8, lane by lane.
+ * @param left The left operand.
+ * @param right The right operand.
+ * @return The dot product of each pair of vectors.
+ */
+[[nodiscard]] constexpr float8 dot(const vec3x8& left, const vec3x8& right) noexcept {
+    return left.x * right.x + left.y * right.y + left.z * right.z;
+}
 
 /**
  * @brief Calculates the dot product of two vec4.
@@ -52,28 +48,81 @@ float dot(const vec3& left, const vec3& right);
  * @param right The right operand.
  * @return The dot product of the two vec4.
  */
-float dot(const vec4& left, const vec4& right);
+[[nodiscard]] constexpr float dot(const vec4& left, const vec4& right) noexcept {
+    return left.x * right.x + left.y * right.y + left.z * right.z + left.w * right.w;
+}
+
+/**
+ * @brief Calculates the length of a vec2.
+ * @param vec The vec2.
+ * @return The length.
+ */
+[[nodiscard]] constexpr float length(const vec2& vec) noexcept {
+    return sqrtf(vec.x * vec.x + vec.y * vec.y);
+}
+
+/**
+ * @brief Calculates the length of a vec3.
+ * @param vec The vec3.
+ * @return The length.
+ */
+[[nodiscard]] constexpr float length(const vec3& vec) noexcept {
+    return sqrtf(vec.x * vec.x + vec.y * vec.y + vec.z * vec.z);
+}
+
+/**
+ * @brief Calculates the lengths of the vectors of a vec3x8.
+ * @param vec The vec3x8.
+ * @return The length of each vector.
+ */
+[[nodiscard]] constexpr float8 length(const vec3x8& vec) noexcept {
+    return sqrt(dot(vec, vec));
+}
+
+/**
+ * @brief Calculates the length of a vec4.
+ * @param vec The vec4.
+ * @return The length.
+ */
+[[nodiscard]] constexpr float length(const vec4& vec) noexcept {
+    return sqrtf(vec.x * vec.x + vec.y * vec.y + vec.z * vec.z + vec.w * vec.w);
+}
 
 /**
  * @brief Calculates the normalized vector of a vec2.
  * @param vec The vec2.
  * @return The normalized vec2.
  */
-vec2 normalize(const vec2& vec);
+[[nodiscard]] constexpr vec2 normalize(const vec2& vec) noexcept {
+    return vec / length(vec);
+}
 
 /**
  * @brief Calculates the normalized vector of a vec3.
  * @param vec The vec3.
  * @return The normalized vec3.
  */
-vec3 normalize(const vec3& vec);
+[[nodiscard]] constexpr vec3 normalize(const vec3& vec) noexcept {
+    return vec / length(vec);
+}
+
+/**
+ * @brief Calculates the normalized vectors of a vec3x8.
+ * @param vec The vec3x8.
+ * @return The vec3x8 of the normalized vectors.
+ */
+[[nodiscard]] constexpr vec3x8 normalize(const vec3x8& vec) noexcept {
+    return vec / length(vec);
+}
 
 /**
  * @brief Calculates the normalized vector of a vec4.
  * @param vec The vec4.
  * @return The normalized vec4.
  */
-vec4 normalize(const vec4& vec);
+[[nodiscard]] constexpr vec4 normalize(const vec4& vec) noexcept {
+    return vec / length(vec);
+}
 
 /**
  * @brief Calculates the cross product of two Vector.
@@ -81,4 +130,34 @@ vec4 normalize(const vec4& vec);
  * @param right The right operand.
  * @return The cross product of the two Vector.
  */
-Vector cross(const Vector& left, const Vector& right);
\ No newline at end of file
+[[nodiscard]] constexpr Vector cross(const Vector& left, const Vector& right) noexcept {
+    return Vector(
+        left.y * right.z - left.z * right.y,
+        left.z * right.x - left.x * right.z,
+        left.x * right.y - left.y * right.x
+    );
+}
+
+/**
+ * @brief Calculates the cross products of the vectors of two vec3x8, lane by lane.
+ * @param left The left operand.
+ * @param right The right operand.
+ * @return The vec3x8 of the cross products.
+ */
+[[nodiscard]] constexpr vec3x8 cross(const vec3x8& left, const vec3x8& right) noexcept {
+    return vec3x8(
+        left.y * right.z - left.z * right.y,
+        left.z * right.x - left.x * right.z,
+        left.x * right.y - left.y * right.x
+    );
+}
+
+/**
+ * @brief Calculates the reflection direction of an incident vector.
+ * @param incident The incident vector.
+ * @param normal The normal of the surface, which should be normalized.
+ * @return The reflection direction.
+ */
+[[nodiscard]] constexpr Vector reflect(const Vector& incident, const Vector& normal) noexcept {
+    return incident - 2.0f * dot(normal, incident) * normal;
+}
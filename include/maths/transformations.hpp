@@ -1,9 +1,16 @@
 /***************************************************************************************************
  * @file  transformations.hpp
- * @brief Declaration of functions for 3D transformations
+ * @brief Declaration and implementation of functions for 3D transformations
  **************************************************************************************************/
 
+#pragma once
+
+#include <cmath>
+#include <span>
+
+#include "geometry.hpp"
 #include "Matrix4.hpp"
+#include "trigonometry.hpp"
 #include "vec4.hpp"
 #include "vec3.hpp"
 
@@ -12,7 +19,13 @@
  * @param scalar The scaling factor.
  * @return The scaling matrix.
  */
-Matrix4 scale(float scalar);
+[[nodiscard]] constexpr Matrix4 scale(float scalar) noexcept {
+    return Matrix4(
+        scalar, 0.0f, 0.0f,
+        0.0f, scalar, 0.0f,
+        0.0f, 0.0f, scalar
+    );
+}
 
 /**
  * @brief Calculates the scaling matrix that scales by a specific factor in each direction.
@@ -21,35 +34,66 @@ Matrix4 scale(float scalar);
  * @param z The scaling factor in the z direction.
  * @return The scaling matrix.
  */
-Matrix4 scale(float x, float y, float z);
+[[nodiscard]] constexpr Matrix4 scale(float x, float y, float z) noexcept {
+    return Matrix4(
+        x, 0.0f, 0.0f,
+        0.0f, y, 0.0f,
+        0.0f, 0.0f, z
+    );
+}
 
 /**
  * @brief Calculates the scaling matrix that only scales in the x direction.
  * @param scalar The scaling factor.
  * @return The scaling matrix.
  */
-Matrix4 scaleX(float scalar);
+[[nodiscard]] constexpr Matrix4 scaleX(float scalar) noexcept {
+    return Matrix4(
+        scalar, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 1.0f
+    );
+}
 
 /**
  * @brief Calculates the scaling matrix that only scales in the y direction.
  * @param scalar The scaling factor.
  * @return The scaling matrix.
  */
-Matrix4 scaleY(float scalar);
+[[nodiscard]] constexpr Matrix4 scaleY(float scalar) noexcept {
+    return Matrix4(
+        1.0f, 0.0f, 0.0f,
+        0.0f, scalar, 0.0f,
+        0.0f, 0.0f, 1.0f
+    );
+}
 
 /**
  * @brief Calculates the scaling matrix that only scales in the z direction.
  * @param scalar The scaling factor.
  * @return The scaling matrix.
  */
-Matrix4 scaleZ(float scalar);
+[[nodiscard]] constexpr Matrix4 scaleZ(float scalar) noexcept {
+    return Matrix4(
+        1.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, scalar
+    );
+}
 
 /**
  * @brief Calculates the translation matrix that displaces by a specific vector.
  * @param vector The translation vector.
  * @return The translation matrix.
  */
-Matrix4 translate(const Vector& vector);
+[[nodiscard]] constexpr Matrix4 translate(const Vector& vector) noexcept {
+    return Matrix4(
+        1.0f, 0.0f, 0.0f, vector.x,
+        0.0f, 1.0f, 0.0f, vector.y,
+        0.0f, 0.0f, 1.0f, vector.z,
+        0.0f, 0.0f, 0.0f, 1.0f
+    );
+}
 
 /**
  * @brief Calculates the translation matrix that displaces by a specific amount in each direction.
@@ -58,28 +102,56 @@ Matrix4 translate(const Vector& vector);
  * @param z The displacement in the z direction.
  * @return The translation matrix.
  */
-Matrix4 translate(float x, float y, float z);
+[[nodiscard]] constexpr Matrix4 translate(float x, float y, float z) noexcept {
+    return Matrix4(
+        1.0f, 0.0f, 0.0f, x,
+        0.0f, 1.0f, 0.0f, y,
+        0.0f, 0.0f, 1.0f, z,
+        0.0f, 0.0f, 0.0f, 1.0f
+    );
+}
 
 /**
  * @brief Calculates the translation matrix that only displaces in the x direction.
  * @param scalar The displacement amount.
  * @return The translation matrix.
  */
-Matrix4 translateX(float scalar);
+[[nodiscard]] constexpr Matrix4 translateX(float scalar) noexcept {
+    return Matrix4(
+        1.0f, 0.0f, 0.0f, scalar,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    );
+}
 
 /**
  * @brief Calculates the translation matrix that only displaces in the y direction.
  * @param scalar The displacement amount.
  * @return The translation matrix.
  */
-Matrix4 translateY(float scalar);
+[[nodiscard]] constexpr Matrix4 translateY(float scalar) noexcept {
+    return Matrix4(
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, scalar,
+        0.0f, 0.0f, 1.0f, 0.0f,
+        0.0f, 0.0f, 0.0f, 1.0f
+    );
+}
 
 /**
  * @brief Calculates the translation matrix that only displaces in the z direction.
  * @param scalar The displacement amount.
  * @return The translation matrix.
  */
-Matrix4 translateZ(float scalar);
+[[nodiscard]] constexpr Matrix4 translateZ(float scalar) noexcept {
+    return Matrix4(
+        1.0f, 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f, 0.0f, 0.0f,
+        0.0f, 0.0f, 1.0f, scalar,
+        0.0f, 0.0f, 0.0f, 1.0f
+    );
+}
 
 /**
  * @brief Calculates the rotation matrix that rotates around an axis by a certain angle.
@@ -87,28 +159,87 @@ Matrix4 translateZ(float scalar);
  * @param axis The rotation axis.
  * @return The rotation matrix.
  */
-Matrix4 rotate(float angle, const Vector& axis);
+[[nodiscard]] constexpr Matrix4 rotate(float angle, const Vector& axis) noexcept {
+    angle = radians(angle);
+
+    float cosine = cosf(angle);
+    float sine = sinf(angle);
+
+    Vector nAxis = axis;
+    if(nAxis != Vector(0.0f, 0.0f, 0.0f)) {
+        nAxis = normalize(axis);
+    }
+
+    Vector temp = (1.0f - cosine) * nAxis;
+
+    return Matrix4(
+        cosine + temp.x * nAxis.x,
+        temp.x * nAxis.y + sine * nAxis.z,
+        temp.x * nAxis.z - sine * nAxis.y,
+
+        temp.y * nAxis.x - sine * nAxis.z,
+        cosine + temp.y * nAxis.y,
+        temp.y * nAxis.z + sine * nAxis.x,
+
+        temp.x * nAxis.x + sine * nAxis.y,
+        temp.x * nAxis.y - sine * nAxis.x,
+        cosine + temp.x * nAxis.z
+    );
+}
 
 /**
  * @brief Calculates the rotation matrix that rotates around the X axis by a certain angle.
  * @param angle The rotation angle in degrees.
  * @return The rotation matrix.
  */
-Matrix4 rotateX(float angle);
+[[nodiscard]] constexpr Matrix4 rotateX(float angle) noexcept {
+    angle = radians(angle);
+
+    const float cosine = cosf(angle);
+    const float sine = sinf(angle);
+
+    return Matrix4(
+        1.0f, 0.0f, 0.0f,
+        0.0f, cosine, -sine,
+        0.0f, sine, cosine
+    );
+}
 
 /**
  * @brief Calculates the rotation matrix that rotates around the Y axis by a certain angle.
  * @param angle The rotation angle in degrees.
  * @return The rotation matrix.
  */
-Matrix4 rotateY(float angle);
+[[nodiscard]] constexpr Matrix4 rotateY(float angle) noexcept {
+    angle = radians(angle);
+
+    const float cosine = cosf(angle);
+    const float sine = sinf(angle);
+
+    return Matrix4(
+        cosine, 0.0f, sine,
+        0.0f, 1.0f, 0.0f,
+        -sine, 0.0f, cosine
+    );
+}
 
 /**
  * @brief Calculates the rotation matrix that rotates around the Z axis by a certain angle.
  * @param angle The rotation angle in degrees.
  * @return The rotation matrix.
  */
-Matrix4 rotateZ(float angle);
+[[nodiscard]] constexpr Matrix4 rotateZ(float angle) noexcept {
+    angle = radians(angle);
+
+    const float cosine = cosf(angle);
+    const float sine = sinf(angle);
+
+    return Matrix4(
+        cosine, -sine, 0.0f,
+        sine, cosine, 0.0f,
+        0.0f, 0.0f, 1.0f
+    );
+}
 
 /**
  * @brief Calculates the 'look at' matrix. That allows to simulate a camera.
@@ -117,7 +248,19 @@ Matrix4 rotateZ(float angle);
  * @param up The up vector of the camera.
  * @return The 'look at' matrix.
  */
-Matrix4 lookAt(const Point& eye, const Point& center, const Vector& up);
+[[nodiscard]] constexpr Matrix4 lookAt(const Point& eye, const Point& center,
+                                       const Vector& up) noexcept {
+    const Vector FRONT = normalize(center - eye);
+    const Vector SIDE = normalize(cross(FRONT, up));
+    const Vector UP = normalize(cross(SIDE, FRONT));
+
+    return Matrix4(
+        SIDE.x, SIDE.y, SIDE.z, -dot(SIDE, eye),
+        UP.x, UP.y, UP.z, -dot(UP, eye),
+        -FRONT.x, -FRONT.y, -FRONT.z, dot(FRONT, eye),
+        0.0f, 0.0f, 0.0f, 1.0f
+    );
+}
 
 /**
  * @brief Calculates the perspective matrix.
@@ -128,4 +271,148 @@ Matrix4 lookAt(const Point& eye, const Point& center, const Vector& up);
  * between the two planes are renderered, those outside won't.
  * @return The perspective matrix.
  */
-Matrix4 perspective(float fov, float aspect, float near, float far);
\ No newline at end of file
+[[nodiscard]] constexpr Matrix4 perspective(float fov, float aspect,
+                                            float near, float far) noexcept {
+    return Matrix4(
+        1.0f / (aspect * tanf(0.5f * fov)), 0.0f, 0.0f, 0.0f,
+        0.0f, 1.0f / tanf(0.5f * fov), 0.0f, 0.0f,
+        0.0f, 0.0f, -(far + near) / (far - near), -(2.0f * far * near) / (far - near),
+        0.0f, 0.0f, -1.0f, 0.0f
+    );
+}
+
+/**
+ * @brief Applies a transformation to a point, which is moved by the translation. The fourth row of
+ * the matrix is ignored, the transformation is assumed to be affine.
+ * @param mat The transformation matrix.
+ * @param point The point.
+ * @return The transformed point.
+ */
+[[nodiscard]] constexpr Point transformPoint(const Matrix4& mat, const Point& point) noexcept {
+    return Point(
+        mat[0][0] * point.x + mat[0][1] * point.y + mat[0][2] * point.z + mat[0][3],
+        mat[1][0] * point.x + mat[1][1] * point.y + mat[1][2] * point.z + mat[1][3],
+        mat[2][0] * point.x + mat[2][1] * point.y + mat[2][2] * point.z + mat[2][3]
+    );
+}
+
+/**
+ * @brief Applies a transformation to a vector, which unlike a point isn't moved by the translation.
+ * @param mat The transformation matrix.
+ * @param vector The vector.
+ * @return The transformed vector.
+ */
+[[nodiscard]] constexpr Vector transformVector(const Matrix4& mat, const Vector& vector) noexcept {
+    return Vector(
+        mat[0][0] * vector.x + mat[0][1] * vector.y + mat[0][2] * vector.z,
+        mat[1][0] * vector.x + mat[1][1] * vector.y + mat[1][2] * vector.z,
+        mat[2][0] * vector.x + mat[2][1] * vector.y + mat[2][2] * vector.z
+    );
+}
+
+#if defined(__SSE__) && !defined(MATHS_NO_SIMD)
+/**
+ * @brief Applies a transformation to the vec3 of an array 4 at a time, as long as 4 are left.
+ * Each group is transposed so that the x, y and z of the 4 vec3 are in their own SSE register.
+ * @param mat The transformation matrix.
+ * @param vecs The vec3.
+ * @param result Where the transformed vec3 are written, at least as long as vecs.
+ * @param w The fourth coordinate of the vec3: 1 for points, 0 for vectors.
+ * @return The number of vec3 that were transformed, a multiple of 4.
+ */
+inline size_t transformBy4(const Matrix4& mat, std::span<const vec3> vecs, std::span<vec3> result,
+                           float w) noexcept {
+    __m128 factors[3][4];
+    for(int i = 0 ; i < 3 ; ++i) {
+        for(int j = 0 ; j < 3 ; ++j) {
+            factors[i][j] = _mm_set1_ps(mat[i][j]);
+        }
+
+        factors[i][3] = _mm_set1_ps(mat[i][3] * w);
+    }
+
+    const size_t count = vecs.size() & ~size_t(3);
+
+    for(size_t i = 0 ; i < count ; i += 4) {
+        // (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3)
+        const float* input = &vecs[i].x;
+        const __m128 a = _mm_loadu_ps(input);
+        const __m128 b = _mm_loadu_ps(input + 4);
+        const __m128 c = _mm_loadu_ps(input + 8);
+
+        const __m128 yz01 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));
+        const __m128 x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)),
+                                        _MM_SHUFFLE(2, 0, 3, 0));
+        const __m128 y = _mm_shuffle_ps(yz01, _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)),
+                                        _MM_SHUFFLE(2, 0, 2, 0));
+        const __m128 z = _mm_shuffle_ps(yz01, c, _MM_SHUFFLE(3, 0, 3, 1));
+
+        __m128 transformed[3];
+        for(int j = 0 ; j < 3 ; ++j) {
+            transformed[j] = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(factors[j][0], x), _mm_mul_ps(factors[j][1], y)),
+                _mm_add_ps(_mm_mul_ps(factors[j][2], z), factors[j][3])
+            );
+        }
+
+        // Transposes back to (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3)
+        const __m128 xy01 = _mm_unpacklo_ps(transformed[0], transformed[1]);
+        const __m128 xy23 = _mm_unpackhi_ps(transformed[0], transformed[1]);
+        const __m128 zx01 = _mm_shuffle_ps(transformed[2], xy01, _MM_SHUFFLE(2, 2, 0, 0));
+        const __m128 yz1 = _mm_shuffle_ps(xy01, transformed[2], _MM_SHUFFLE(1, 1, 3, 3));
+        const __m128 zx23 = _mm_shuffle_ps(transformed[2], xy23, _MM_SHUFFLE(2, 2, 2, 2));
+        const __m128 yz3 = _mm_shuffle_ps(xy23, transformed[2], _MM_SHUFFLE(3, 3, 3, 3));
+
+        float* output = &result[i].x;
+        _mm_storeu_ps(output, _mm_shuffle_ps(xy01, zx01, _MM_SHUFFLE(2, 0, 1, 0)));
+        _mm_storeu_ps(output + 4, _mm_shuffle_ps(yz1, xy23, _MM_SHUFFLE(1, 0, 2, 0)));
+        _mm_storeu_ps(output + 8, _mm_shuffle_ps(zx23, yz3, _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+
+    return count;
+}
+#endif
+
+/**
+ * @brief Applies a transformation to each point of an array, 4 at a time with SSE.
+ * @param mat The transformation matrix.
+ * @param points The points.
+ * @param result Where the transformed points are written, at least as long as the points. It can
+ * be the array of points itself.
+ */
+constexpr void transformPoints(const Matrix4& mat, std::span<const Point> points,
+                               std::span<Point> result) noexcept {
+    size_t i = 0;
+
+#if defined(__SSE__) && !defined(MATHS_NO_SIMD)
+    if !consteval {
+        i = transformBy4(mat, points, result, 1.0f);
+    }
+#endif
+
+    for( ; i < points.size() ; ++i) {
+        result[i] = transformPoint(mat, points[i]);
+    }
+}
+
+/**
+ * @brief Applies a transformation to each vector of an array, 4 at a time with SSE.
+ * @param mat The transformation matrix.
+ * @param vectors The vectors.
+ * @param result Where the transformed vectors are written, at least as long as the vectors. It can
+ * be the array of vectors itself.
+ */
+constexpr void transformVectors(const Matrix4& mat, std::span<const Vector> vectors,
+                                std::span<Vector> result) noexcept {
+    size_t i = 0;
+
+#if defined(__SSE__) && !defined(MATHS_NO_SIMD)
+    if !consteval {
+        i = transformBy4(mat, vectors, result, 0.0f);
+    }
+#endif
+
+    for( ; i < vectors.size() ; ++i) {
+        result[i] = transformVector(mat, vectors[i]);
+    }
+}
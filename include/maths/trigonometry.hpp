@@ -1,20 +1,26 @@
 /***************************************************************************************************
  * @file  trigonometry.hpp
- * @brief Declaration of functions regarding trigonometry
+ * @brief Declaration and implementation of functions regarding trigonometry
  **************************************************************************************************/
 
 #pragma once
 
+#include <cmath>
+
 /**
  * @brief Converts degrees to radians.
  * @param deg The angle in degrees.
  * @return The angle in radians.
  */
-float radians(float deg);
+[[nodiscard]] constexpr float radians(float deg) noexcept {
+    return deg * M_PIf / 180.0f;
+}
 
 /**
  * @brief Converts radians to degrees.
  * @param rad The angle in radians.
  * @return The angle in degrees.
  */
-float degrees(float rad);
\ No newline at end of file
+[[nodiscard]] constexpr float degrees(float rad) noexcept {
+    return rad * 180.0f / M_PIf;
+}
\ No newline at end of file
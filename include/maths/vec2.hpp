@@ -1,6 +1,6 @@
 /***************************************************************************************************
  * @file  vec2.hpp
- * @brief Declaration of the vec2 struct
+ * @brief Declaration and implementation of the vec2 struct
  **************************************************************************************************/
 
 #pragma once
@@ -15,76 +15,116 @@ struct vec2 {
     /**
      * @brief Constructs a vec2 with all components equal to 0.
      */
-    vec2();
+    constexpr vec2() noexcept : x(0.0f), y(0.0f) { }
 
     /**
      * @brief Constructs a vec2 with a specific value for each component.
      * @param x The value of the x component.
      * @param y The value of the y component.
      */
-    vec2(float x, float y);
+    constexpr vec2(float x, float y) noexcept : x(x), y(y) { }
 
     /**
      * @brief Constructs a vec2 with the same value for each component.
      * @param scalar The value of each component.
      */
-    vec2(float scalar);
+    constexpr vec2(float scalar) noexcept : x(scalar), y(scalar) { }
 
     /**
      * @brief Adds another vec2's components to the current instance's components.
      * @param vec The vec2 to add.
      * @return A reference to this instance.
      */
-    vec2& operator +=(const vec2& vec);
+    constexpr vec2& operator +=(const vec2& vec) noexcept {
+        x += vec.x;
+        y += vec.y;
+
+        return *this;
+    }
 
     /**
      * @brief Subtracts the current instance's components by another vec2's components.
      * @param vec The vec2 to subtract by.
      * @return A reference to this instance.
      */
-    vec2& operator -=(const vec2& vec);
+    constexpr vec2& operator -=(const vec2& vec) noexcept {
+        x -= vec.x;
+        y -= vec.y;
+
+        return *this;
+    }
 
     /**
      * @brief Multiplies the current instance's components by another vec2's components.
      * @param vec The vec2 to multiply by.
      * @return A reference to this instance.
      */
-    vec2& operator *=(const vec2& vec);
+    constexpr vec2& operator *=(const vec2& vec) noexcept {
+        x *= vec.x;
+        y *= vec.y;
+
+        return *this;
+    }
 
     /**
      * @brief Divides the current instance's components by another vec2's components.
      * @param vec The vec2 to divide by.
      * @return A reference to this instance.
      */
-    vec2& operator /=(const vec2& vec);
+    constexpr vec2& operator /=(const vec2& vec) noexcept {
+        x /= vec.x;
+        y /= vec.y;
+
+        return *this;
+    }
 
     /**
      * @brief Adds a scalar to all of the current instance's components.
      * @param scalar The scalar to add.
      * @return A reference to this instance.
      */
-    vec2& operator +=(float scalar);
+    constexpr vec2& operator +=(float scalar) noexcept {
+        x += scalar;
+        y += scalar;
+
+        return *this;
+    }
 
     /**
      * @brief Subtracts all of the current instance's components by a scalar.
      * @param scalar The scalar to subtract by.
      * @return A reference to this instance.
      */
-    vec2& operator -=(float scalar);
+    constexpr vec2& operator -=(float scalar) noexcept {
+        x -= scalar;
+        y -= scalar;
+
+        return *this;
+    }
 
     /**
      * @brief Multiplies all of the current instance's components by a scalar.
      * @param scalar The scalar to multiply by.
      * @return A reference to this instance.
      */
-    vec2& operator *=(float scalar);
+    constexpr vec2& operator *=(float scalar) noexcept {
+        x *= scalar;
+        y *= scalar;
+
+        return *this;
+    }
 
     /**
      * @brief Divides all of the current instance's components by a scalar.
      * @param scalar The scalar to divide by.
      * @return A reference to this instance.
      */
-    vec2& operator /=(float scalar);
+    constexpr vec2& operator /=(float scalar) noexcept {
+        x /= scalar;
+        y /= scalar;
+
+        return *this;
+    }
 
     float x; ///< The x component of the vec2.
     float y; ///< The y component of the vec2.
@@ -98,7 +138,10 @@ using TexCoord = vec2;
  * @param vec The vec2 to write to the stream.
  * @return A reference to the output stream after writing the vec2.
  */
-std::ostream& operator <<(std::ostream& stream, const vec2& vec);
+inline std::ostream& operator <<(std::ostream& stream, const vec2& vec) {
+    stream << "( " << vec.x << " ; " << vec.y << " )";
+    return stream;
+}
 
 /**
  * @brief Reads two values from the input stream and assigns them to the x and y components
@@ -107,70 +150,118 @@ std::ostream& operator <<(std::ostream& stream, const vec2& vec);
  * @param vec The vec2 to assign the read values to.
  * @return A reference to the input stream after reading the values and assigning them to vec2.
  */
-std::istream& operator >>(std::istream& stream, vec2& vec);
+inline std::istream& operator >>(std::istream& stream, vec2& vec) {
+    stream >> vec.x >> vec.y;
+    return stream;
+}
 
 /** @brief Adds a vec2's components to another's.
  *  @param left The left operand.
  *  @param right The right operand.
  *  @return The component-wise sum of the two vec2.
  */
-vec2 operator +(const vec2& left, const vec2& right);
+[[nodiscard]] constexpr vec2 operator +(const vec2& left, const vec2& right) noexcept {
+    return vec2(
+        left.x + right.x,
+        left.y + right.y
+    );
+}
 
 /** @brief Subtracts a vec2's components by another's.
  *  @param left The left operand.
  *  @param right The right operand.
  *  @return The component-wise subtraction of the first vec2 by the second.
  */
-vec2 operator -(const vec2& left, const vec2& right);
+[[nodiscard]] constexpr vec2 operator -(const vec2& left, const vec2& right) noexcept {
+    return vec2(
+        left.x - right.x,
+        left.y - right.y
+    );
+}
 
 /** @brief Multiplies a vec2's components by another's.
  *  @param left The left operand.
  *  @param right The right operand.
  *  @return The component-wise product of the two vec2.
  */
-vec2 operator *(const vec2& left, const vec2& right);
+[[nodiscard]] constexpr vec2 operator *(const vec2& left, const vec2& right) noexcept {
+    return vec2(
+        left.x * right.x,
+        left.y * right.y
+    );
+}
 
 /** @brief Divides a vec2's components by another's.
  *  @param left The left operand.
  *  @param right The right operand.
  *  @return The component-wise division of the first vec2 by the second.
  */
-vec2 operator /(const vec2& left, const vec2& right);
+[[nodiscard]] constexpr vec2 operator /(const vec2& left, const vec2& right) noexcept {
+    return vec2(
+        left.x / right.x,
+        left.y / right.y
+    );
+}
 
 /** @brief Adds a scalar to each of a vec2's components.
  *  @param vec The vec2.
  *  @param scalar The scalar.
  *  @return The component-wise sum of a vec2 by a scalar.
  */
-vec2 operator +(const vec2& vec, float scalar);
+[[nodiscard]] constexpr vec2 operator +(const vec2& vec, float scalar) noexcept {
+    return vec2(
+        vec.x + scalar,
+        vec.y + scalar
+    );
+}
 
 /** @brief Subtracts each of a vec2's components by a scalar.
  *  @param vec The vec2.
  *  @param scalar The scalar.
  *  @return The component-wise subtraction of a vec2 by a scalar.
  */
-vec2 operator -(const vec2& vec, float scalar);
+[[nodiscard]] constexpr vec2 operator -(const vec2& vec, float scalar) noexcept {
+    return vec2(
+        vec.x - scalar,
+        vec.y - scalar
+    );
+}
 
 /** @brief Multiplies each of a vec2's components by a scalar.
  *  @param vec The vec2.
  *  @param scalar The scalar.
  *  @return The component-wise product of a vec2 by a scalar.
  */
-vec2 operator *(const vec2& vec, float scalar);
+[[nodiscard]] constexpr vec2 operator *(const vec2& vec, float scalar) noexcept {
+    return vec2(
+        vec.x * scalar,
+        vec.y * scalar
+    );
+}
 
 /** @brief Multiplies each of a vec2's components by a scalar.
  *  @param scalar The scalar.
  *  @param vec The vec2.
  *  @return The component-wise product of a vec2 by a scalar.
  */
-vec2 operator *(float scalar, const vec2& vec);
+[[nodiscard]] constexpr vec2 operator *(float scalar, const vec2& vec) noexcept {
+    return vec2(
+        scalar * vec.x,
+        scalar * vec.y
+    );
+}
 
 /** @brief Divides each of a vec2's components by a scalar.
  *  @param vec The vec2.
  *  @param scalar The scalar.
  *  @return The component-wise division of a vec2 by a scalar.
  */
-vec2 operator /(const vec2& vec, float scalar);
+[[nodiscard]] constexpr vec2 operator /(const vec2& vec, float scalar) noexcept {
+    return vec2(
+        vec.x / scalar,
+        vec.y / scalar
+    );
+}
 
 /**
  * @brief Tests whether two vec2 are equal.
@@ -178,7 +269,9 @@ vec2 operator /(const vec2& vec, float scalar);
  * @param right The right operand.
  * @return Whether the two vec2 are equal.
  */
-bool operator ==(const vec2& left, const vec2& right);
+[[nodiscard]] constexpr bool operator ==(const vec2& left, const vec2& right) noexcept {
+    return left.x == right.x && left.y == right.y;
+}
 
 /**
  * @brief Tests whether two vec2 are different.
@@ -186,4 +279,6 @@ bool operator ==(const vec2& left, const vec2& right);
  * @param right The right operand.
  * @return Whether the two vec2 are different.
  */
-bool operator !=(const vec2& left, const vec2& right);
\ No newline at end of file
+[[nodiscard]] constexpr bool operator !=(const vec2& left, const vec2& right) noexcept {
+    return left.x != right.x || left.y != right.y;
+}
\ No newline at end of file
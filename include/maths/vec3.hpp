@@ -1,6 +1,6 @@
 /***************************************************************************************************
  * @file  vec3.hpp
- * @brief Declaration of the vec3 struct
+ * @brief Declaration and implementation of the vec3 struct
  **************************************************************************************************/
 
 #pragma once
@@ -15,7 +15,7 @@ struct vec3 {
     /**
      * @brief Constructs a vec3 with all components equal to 0.
      */
-    vec3();
+    constexpr vec3() noexcept : x(0.0f), y(0.0f), z(0.0f) { }
 
     /**
      * @brief Constructs a vec3 with a specific value for each component.
@@ -23,69 +23,117 @@ struct vec3 {
      * @param y The value of the y component.
      * @param z The value of the z component.
      */
-    vec3(float x, float y, float z);
+    constexpr vec3(float x, float y, float z) noexcept : x(x), y(y), z(z) { }
 
     /**
      * @brief Constructs a vec3 with the same value for each component.
      * @param scalar The value of each component.
      */
-    vec3(float scalar);
+    constexpr vec3(float scalar) noexcept : x(scalar), y(scalar), z(scalar) { }
 
     /**
      * @brief Adds another vec3's components to the current instance's components.
      * @param vec The vec3 to add.
      * @return A reference to this instance.
      */
-    vec3& operator +=(const vec3& vec);
+    constexpr vec3& operator +=(const vec3& vec) noexcept {
+        x += vec.x;
+        y += vec.y;
+        z += vec.z;
+
+        return *this;
+    }
 
     /**
      * @brief Subtracts the current instance's components by another vec3's components.
      * @param vec The vec3 to subtract by.
      * @return A reference to this instance.
      */
-    vec3& operator -=(const vec3& vec);
+    constexpr vec3& operator -=(const vec3& vec) noexcept {
+        x -= vec.x;
+        y -= vec.y;
+        z -= vec.z;
+
+        return *this;
+    }
 
     /**
      * @brief Multiplies the current instance's components by another vec3's components.
      * @param vec The vec3 to multiply by.
      * @return A reference to this instance.
      */
-    vec3& operator *=(const vec3& vec);
+    constexpr vec3& operator *=(const vec3& vec) noexcept {
+        x *= vec.x;
+        y *= vec.y;
+        z *= vec.z;
+
+        return *this;
+    }
 
     /**
      * @brief Divides the current instance's components by another vec3's components.
      * @param vec The vec3 to divide by.
      * @return A reference to this instance.
      */
-    vec3& operator /=(const vec3& vec);
+    constexpr vec3& operator /=(const vec3& vec) noexcept {
+        x /= vec.x;
+        y /= vec.y;
+        z /= vec.z;
+
+        return *this;
+    }
 
     /**
      * @brief Adds a scalar to all of the current instance's components.
      * @param scalar The scalar to add.
      * @return A reference to this instance.
      */
-    vec3& operator +=(float scalar);
+    constexpr vec3& operator +=(float scalar) noexcept {
+        x += scalar;
+        y += scalar;
+        z += scalar;
+
+        return *this;
+    }
 
     /**
      * @brief Subtracts all of the current instance's components by a scalar.
      * @param scalar The scalar to subtract by.
      * @return A reference to this instance.
      */
-    vec3& operator -=(float scalar);
+    constexpr vec3& operator -=(float scalar) noexcept {
+        x -= scalar;
+        y -= scalar;
+        z -= scalar;
+
+        return *this;
+    }
 
     /**
      * @brief Multiplies all of the current instance's components by a scalar.
      * @param scalar The scalar to multiply by.
      * @return A reference to this instance.
      */
-    vec3& operator *=(float scalar);
+    constexpr vec3& operator *=(float scalar) noexcept {
+        x *= scalar;
+        y *= scalar;
+        z *= scalar;
+
+        return *this;
+    }
 
     /**
      * @brief Divides all of the current instance's components by a scalar.
      * @param scalar The scalar to divide by.
      * @return A reference to this instance.
      */
-    vec3& operator /=(float scalar);
+    constexpr vec3& operator /=(float scalar) noexcept {
+        x /= scalar;
+        y /= scalar;
+        z /= scalar;
+
+        return *this;
+    }
 
     float x; ///< The x component of the vec3.
     float y; ///< The y component of the vec3.
@@ -103,7 +151,10 @@ using Vector = vec3;
  * @param vec The vec3 to write to the stream.
  * @return A reference to the output stream after writing the vec3.
  */
-std::ostream& operator <<(std::ostream& stream, const vec3& vec);
+inline std::ostream& operator <<(std::ostream& stream, const vec3& vec) {
+    stream << "( " << vec.x << " ; " << vec.y << " ; " << vec.z << " )";
+    return stream;
+}
 
 /**
  * @brief Reads three values from the input stream and assigns them to the x, y and z components
@@ -112,70 +163,127 @@ std::ostream& operator <<(std::ostream& stream, const vec3& vec);
  * @param vec The vec3 to assign the read values to.
  * @return A reference to the input stream after reading the values and assigning them to vec3.
  */
-std::istream& operator >>(std::istream& stream, vec3& vec);
+inline std::istream& operator >>(std::istream& stream, vec3& vec) {
+    stream >> vec.x >> vec.y >> vec.z;
+    return stream;
+}
 
 /** @brief Adds a vec3's components to another's.
  *  @param left The left operand.
  *  @param right The right operand.
  *  @return The component-wise sum of the two vec3.
  */
-vec3 operator +(const vec3& left, const vec3& right);
+[[nodiscard]] constexpr vec3 operator +(const vec3& left, const vec3& right) noexcept {
+    return vec3(
+        left.x + right.x,
+        left.y + right.y,
+        left.z + right.z
+    );
+}
 
 /** @brief Subtracts a vec3's components by another's.
  *  @param left The left operand.
  *  @param right The right operand.
  *  @return The component-wise subtraction of the first vec3 by the second.
  */
-vec3 operator -(const vec3& left, const vec3& right);
+[[nodiscard]] constexpr vec3 operator -(const vec3& left, const vec3& right) noexcept {
+    return vec3(
+        left.x - right.x,
+        left.y - right.y,
+        left.z - right.z
+    );
+}
 
 /** @brief Multiplies a vec3's components by another's.
  *  @param left The left operand.
  *  @param right The right operand.
  *  @return The component-wise product of the two vec3.
  */
-vec3 operator *(const vec3& left, const vec3& right);
+[[nodiscard]] constexpr vec3 operator *(const vec3& left, const vec3& right) noexcept {
+    return vec3(
+        left.x * right.x,
+        left.y * right.y,
+        left.z * right.z
+    );
+}
 
 /** @brief Divides a vec3's components by another's.
  *  @param left The left operand.
  *  @param right The right operand.
  *  @return The component-wise division of the first vec3 by the second.
  */
-vec3 operator /(const vec3& left, const vec3& right);
+[[nodiscard]] constexpr vec3 operator /(const vec3& left, const vec3& right) noexcept {
+    return vec3(
+        left.x / right.x,
+        left.y / right.y,
+        left.z / right.z
+    );
+}
 
 /** @brief Adds a scalar to each of a vec3's components.
  *  @param vec The vec3.
  *  @param scalar The scalar.
  *  @return The component-wise sum of a vec3 by a scalar.
  */
-vec3 operator +(const vec3& vec, float scalar);
+[[nodiscard]] constexpr vec3 operator +(const vec3& vec, float scalar) noexcept {
+    return vec3(
+        vec.x + scalar,
+        vec.y + scalar,
+        vec.z + scalar
+    );
+}
 
 /** @brief Subtracts each of a vec3's components by a scalar.
  *  @param vec The vec3.
  *  @param scalar The scalar.
  *  @return The component-wise subtraction of a vec3 by a scalar.
  */
-vec3 operator -(const vec3& vec, float scalar);
+[[nodiscard]] constexpr vec3 operator -(const vec3& vec, float scalar) noexcept {
+    return vec3(
+        vec.x - scalar,
+        vec.y - scalar,
+        vec.z - scalar
+    );
+}
 
 /** @brief Multiplies each of a vec3's components by a scalar.
  *  @param vec The vec3.
  *  @param scalar The scalar.
  *  @return The component-wise product of a vec3 by a scalar.
  */
-vec3 operator *(const vec3& vec, float scalar);
+[[nodiscard]] constexpr vec3 operator *(const vec3& vec, float scalar) noexcept {
+    return vec3(
+        vec.x * scalar,
+        vec.y * scalar,
+        vec.z * scalar
+    );
+}
 
 /** @brief Multiplies each of a vec3's components by a scalar.
  *  @param scalar The scalar.
  *  @param vec The vec3.
  *  @return The component-wise product of a vec3 by a scalar.
  */
-vec3 operator *(float scalar, const vec3& vec);
+[[nodiscard]] constexpr vec3 operator *(float scalar, const vec3& vec) noexcept {
+    return vec3(
+        scalar * vec.x,
+        scalar * vec.y,
+        scalar * vec.z
+    );
+}
 
 /** @brief Divides each of a vec3's components by a scalar.
  *  @param vec The vec3.
  *  @param scalar The scalar.
  *  @return The component-wise division of a vec3 by a scalar.
  */
-vec3 operator /(const vec3& vec, float scalar);
+[[nodiscard]] constexpr vec3 operator /(const vec3& vec, float scalar) noexcept {
+    return vec3(
+        vec.x / scalar,
+        vec.y / scalar,
+        vec.z / scalar
+    );
+}
 
 /**
  * @brief Tests whether two vec3 are equal.
@@ -183,7 +291,9 @@ vec3 operator /(const vec3& vec, float scalar);
  * @param right The right operand.
  * @return Whether the two vec3 are equal.
  */
-bool operator ==(const vec3& left, const vec3& right);
+[[nodiscard]] constexpr bool operator ==(const vec3& left, const vec3& right) noexcept {
+    return left.x == right.x && left.y == right.y && left.z == right.z;
+}
 
 /**
  * @brief Tests whether two vec3 are different.
@@ -191,4 +301,6 @@ bool operator ==(const vec3& left, const vec3& right);
  * @param right The right operand.
  * @return Whether the two vec3 are different.
  */
-bool operator !=(const vec3& left, const vec3& right);
\ No newline at end of file
+[[nodiscard]] constexpr bool operator !=(const vec3& left, const vec3& right) noexcept {
+    return left.x != right.x || left.y != right.y || left.z != right.z;
+}
\ No newline at end of file
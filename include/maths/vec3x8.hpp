@@ -0,0 +1,239 @@
+/***************************************************************************************************
+ * @file  vec3x8.hpp
+ * @brief Declaration and implementation of the vec3x8 struct
+ **************************************************************************************************/
+
+#pragma once
+
+#include <iostream>
+
+#include "float8.hpp"
+#include "vec3.hpp"
+
+/**
+ * @struct vec3x8
+ * @brief Represents 8 vec3 stored as structure of arrays, each component of the 8 vectors in its
+ * own float8. Operations then process the 8 vectors together instead of one component at a time.
+ */
+struct vec3x8 {
+    static constexpr unsigned int SIZE = float8::SIZE; ///< The number of vectors.
+
+    /**
+     * @brief Constructs 8 vec3 with all components equal to 0.
+     */
+    constexpr vec3x8() noexcept : x(), y(), z() { }
+
+    /**
+     * @brief Constructs 8 vec3 from the lanes of each component.
+     * @param x The x components.
+     * @param y The y components.
+     * @param z The z components.
+     */
+    constexpr vec3x8(const float8& x, const float8& y, const float8& z) noexcept
+        : x(x), y(y), z(z) { }
+
+    /**
+     * @brief Constructs 8 copies of a vec3.
+     * @param vec The vec3.
+     */
+    constexpr vec3x8(const vec3& vec) noexcept : x(vec.x), y(vec.y), z(vec.z) { }
+
+    /**
+     * @brief Reads 8 consecutive vec3 and transposes them.
+     * @param vecs The vec3.
+     * @return The vec3x8 holding the vec3 in order.
+     */
+    [[nodiscard]] static constexpr vec3x8 load(const vec3* vecs) noexcept {
+        float x[SIZE] {}, y[SIZE] {}, z[SIZE] {};
+
+        for(unsigned int lane = 0u ; lane < SIZE ; ++lane) {
+            x[lane] = vecs[lane].x;
+            y[lane] = vecs[lane].y;
+            z[lane] = vecs[lane].z;
+        }
+
+        return vec3x8(float8::load(x), float8::load(y), float8::load(z));
+    }
+
+    /**
+     * @brief Transposes the vectors back and writes them to 8 consecutive vec3.
+     * @param vecs The vec3.
+     */
+    constexpr void store(vec3* vecs) const noexcept {
+        for(unsigned int lane = 0u ; lane < SIZE ; ++lane) {
+            vecs[lane] = (*this)[lane];
+        }
+    }
+
+    /**
+     * @brief Gets one of the vectors.
+     * @param lane The index of the vector, less than SIZE.
+     * @return The vector.
+     */
+    [[nodiscard]] constexpr vec3 operator [](unsigned int lane) const noexcept {
+        return vec3(x[lane], y[lane], z[lane]);
+    }
+
+    /**
+     * @brief Adds another vec3x8's components to the current instance's components.
+     * @param vec The vec3x8 to add.
+     * @return A reference to this instance.
+     */
+    constexpr vec3x8& operator +=(const vec3x8& vec) noexcept {
+        x += vec.x;
+        y += vec.y;
+        z += vec.z;
+
+        return *this;
+    }
+
+    /**
+     * @brief Subtracts the current instance's components by another vec3x8's components.
+     * @param vec The vec3x8 to subtract by.
+     * @return A reference to this instance.
+     */
+    constexpr vec3x8& operator -=(const vec3x8& vec) noexcept {
+        x -= vec.x;
+        y -= vec.y;
+        z -= vec.z;
+
+        return *this;
+    }
+
+    /**
+     * @brief Multiplies the current instance's components by another vec3x8's components.
+     * @param vec The vec3x8 to multiply by.
+     * @return A reference to this instance.
+     */
+    constexpr vec3x8& operator *=(const vec3x8& vec) noexcept {
+        x *= vec.x;
+        y *= vec.y;
+        z *= vec.z;
+
+        return *this;
+    }
+
+    /**
+     * @brief Multiplies all of each vector's components by the scalar of its lane.
+     * @param scalars The scalars to multiply by.
+     * @return A reference to this instance.
+     */
+    constexpr vec3x8& operator *=(const float8& scalars) noexcept {
+        x *= scalars;
+        y *= scalars;
+        z *= scalars;
+
+        return *this;
+    }
+
+    /**
+     * @brief Divides all of each vector's components by the scalar of its lane.
+     * @param scalars The scalars to divide by.
+     * @return A reference to this instance.
+     */
+    constexpr vec3x8& operator /=(const float8& scalars) noexcept {
+        x /= scalars;
+        y /= scalars;
+        z /= scalars;
+
+        return *this;
+    }
+
+    float8 x; ///< The x components of the vectors.
+    float8 y; ///< The y components of the vectors.
+    float8 z; ///< The z components of the vectors.
+};
+
+/**
+ * @brief Writes the vectors of the given vec3x8 to the output stream, one vec3 per line.
+ * @param stream The output stream to write to.
+ * @param vec The vec3x8 to write to the stream.
+ * @return A reference to the output stream after writing the vec3x8.
+ */
+inline std::ostream& operator <<(std::ostream& stream, const vec3x8& vec) {
+    for(unsigned int lane = 0u ; lane < vec3x8::SIZE ; ++lane) {
+        stream << vec[lane] << '\n';
+    }
+
+    return stream;
+}
+
+/** @brief Adds a vec3x8's components to another's. A vec3 is added to every vector.
+ *  @param left The left operand.
+ *  @param right The right operand.
+ *  @return The component-wise sum of the two vec3x8.
+ */
+[[nodiscard]] constexpr vec3x8 operator +(const vec3x8& left, const vec3x8& right) noexcept {
+    return vec3x8(
+        left.x + right.x,
+        left.y + right.y,
+        left.z + right.z
+    );
+}
+
+/** @brief Subtracts a vec3x8's components by another's. A vec3 is subtracted from every vector.
+ *  @param left The left operand.
+ *  @param right The right operand.
+ *  @return The component-wise subtraction of the first vec3x8 by the second.
+ */
+[[nodiscard]] constexpr vec3x8 operator -(const vec3x8& left, const vec3x8& right) noexcept {
+    return vec3x8(
+        left.x - right.x,
+        left.y - right.y,
+        left.z - right.z
+    );
+}
+
+/** @brief Multiplies a vec3x8's components by another's.
+ *  @param left The left operand.
+ *  @param right The right operand.
+ *  @return The component-wise product of the two vec3x8.
+ */
+[[nodiscard]] constexpr vec3x8 operator *(const vec3x8& left, const vec3x8& right) noexcept {
+    return vec3x8(
+        left.x * right.x,
+        left.y * right.y,
+        left.z * right.z
+    );
+}
+
+/** @brief Multiplies each vector's components by the scalar of its lane. A float multiplies every
+ *  vector.
+ *  @param vec The vec3x8.
+ *  @param scalars The scalars.
+ *  @return The product of each vector by its scalar.
+ */
+[[nodiscard]] constexpr vec3x8 operator *(const vec3x8& vec, const float8& scalars) noexcept {
+    return vec3x8(
+        vec.x * scalars,
+        vec.y * scalars,
+        vec.z * scalars
+    );
+}
+
+/** @brief Multiplies each vector's components by the scalar of its lane. A float multiplies every
+ *  vector.
+ *  @param scalars The scalars.
+ *  @param vec The vec3x8.
+ *  @return The product of each vector by its scalar.
+ */
+[[nodiscard]] constexpr vec3x8 operator *(const float8& scalars, const vec3x8& vec) noexcept {
+    return vec3x8(
+        scalars * vec.x,
+        scalars * vec.y,
+        scalars * vec.z
+    );
+}
+
+/** @brief Divides each vector's components by the scalar of its lane. A float divides every vector.
+ *  @param vec The vec3x8.
+ *  @param scalars The scalars.
+ *  @return The division of each vector by its scalar.
+ */
+[[nodiscard]] constexpr vec3x8 operator /(const vec3x8& vec, const float8& scalars) noexcept {
+    return vec3x8(
+        vec.x / scalars,
+        vec.y / scalars,
+        vec.z / scalars
+    );
+}
@@ -1,6 +1,6 @@
 /***************************************************************************************************
  * @file  vec4.hpp
- * @brief Declaration of the vec4 struct
+ * @brief Declaration and implementation of the vec4 struct
  **************************************************************************************************/
 
 #pragma once
@@ -15,7 +15,7 @@ struct vec4 {
     /**
      * @brief Constructs a vec4 with all components equal to 0.
      */
-    vec4();
+    constexpr vec4() noexcept : x(0.0f), y(0.0f), z(0.0f), w(0.0f) { }
 
     /**
      * @brief Constructs a vec4 with a specific value for each component.
@@ -24,69 +24,125 @@ struct vec4 {
      * @param z The value of the z component.
      * @param w The value of the w component.
      */
-    vec4(float x, float y, float z, float w);
+    constexpr vec4(float x, float y, float z, float w) noexcept : x(x), y(y), z(z), w(w) { }
 
     /**
      * @brief Constructs a vec4 with the same value for each component.
      * @param scalar The value of each component.
      */
-    vec4(float scalar);
+    constexpr vec4(float scalar) noexcept : x(scalar), y(scalar), z(scalar), w(scalar) { }
 
     /**
      * @brief Adds another vec4's components to the current instance's components.
      * @param vec The vec4 to add.
      * @return A reference to this instance.
      */
-    vec4& operator +=(const vec4& vec);
+    constexpr vec4& operator +=(const vec4& vec) noexcept {
+        x += vec.x;
+        y += vec.y;
+        z += vec.z;
+        w += vec.w;
+
+        return *this;
+    }
 
     /**
      * @brief Subtracts the current instance's components by another vec4's components.
      * @param vec The vec4 to subtract by.
      * @return A reference to this instance.
      */
-    vec4& operator -=(const vec4& vec);
+    constexpr vec4& operator -=(const vec4& vec) noexcept {
+        x -= vec.x;
+        y -= vec.y;
+        z -= vec.z;
+        w -= vec.w;
+
+        return *this;
+    }
 
     /**
      * @brief Multiplies the current instance's components by another vec4's components.
      * @param vec The vec4 to multiply by.
      * @return A reference to this instance.
      */
-    vec4& operator *=(const vec4& vec);
+    constexpr vec4& operator *=(const vec4& vec) noexcept {
+        x *= vec.x;
+        y *= vec.y;
+        z *= vec.z;
+        w *= vec.w;
+
+        return *this;
+    }
 
     /**
      * @brief Divides the current instance's components by another vec4's components.
      * @param vec The vec4 to divide by.
      * @return A reference to this instance.
      */
-    vec4& operator /=(const vec4& vec);
+    constexpr vec4& operator /=(const vec4& vec) noexcept {
+        x /= vec.x;
+        y /= vec.y;
+        z /= vec.z;
+        w /= vec.w;
+
+        return *this;
+    }
 
     /**
      * @brief Adds a scalar to all of the current instance's components.
      * @param scalar The scalar to add.
      * @return A reference to this instance.
      */
-    vec4& operator +=(float scalar);
+    constexpr vec4& operator +=(float scalar) noexcept {
+        x += scalar;
+        y += scalar;
+        z += scalar;
+        w += scalar;
+
+        return *this;
+    }
 
     /**
      * @brief Subtracts all of the current instance's components by a scalar.
      * @param scalar The scalar to subtract by.
      * @return A reference to this instance.
      */
-    vec4& operator -=(float scalar);
+    constexpr vec4& operator -=(float scalar) noexcept {
+        x -= scalar;
+        y -= scalar;
+        z -= scalar;
+        w -= scalar;
+
+        return *this;
+    }
 
     /**
      * @brief Multiplies all of the current instance's components by a scalar.
      * @param scalar The scalar to multiply by.
      * @return A reference to this instance.
      */
-    vec4& operator *=(float scalar);
+    constexpr vec4& operator *=(float scalar) noexcept {
+        x *= scalar;
+        y *= scalar;
+        z *= scalar;
+        w *= scalar;
+
+        return *this;
+    }
 
     /**
      * @brief Divides all of the current instance's components by a scalar.
      * @param scalar The scalar to divide by.
      * @return A reference to this instance.
      */
-    vec4& operator /=(float scalar);
+    constexpr vec4& operator /=(float scalar) noexcept {
+        x /= scalar;
+        y /= scalar;
+        z /= scalar;
+        w /= scalar;
+
+        return *this;
+    }
 
     float x; ///< The x component of the vec4.
     float y; ///< The y component of the vec4.
@@ -101,7 +157,10 @@ struct vec4 {
  * @param vec The vec4 to write to the stream.
  * @return A reference to the output stream after writing the vec4.
  */
-std::ostream& operator <<(std::ostream& stream, const vec4& vec);
+inline std::ostream& operator <<(std::ostream& stream, const vec4& vec) {
+    stream << "( " << vec.x << " ; " << vec.y << " ; " << vec.z << " ; " << vec.w << " )";
+    return stream;
+}
 
 /**
  * @brief Reads four values from the input stream and assigns them to the x, y, z and w components
@@ -110,70 +169,136 @@ std::ostream& operator <<(std::ostream& stream, const vec4& vec);
  * @param vec The vec4 to assign the read values to.
  * @return A reference to the input stream after reading the values and assigning them to vec4.
  */
-std::istream& operator >>(std::istream& stream, vec4& vec);
+inline std::istream& operator >>(std::istream& stream, vec4& vec) {
+    stream >> vec.x >> vec.y >> vec.z >> vec.w;
+    return stream;
+}
 
 /** @brief Adds a vec4's components to another's.
  *  @param left The left operand.
  *  @param right The right operand.
  *  @return The component-wise sum of the two vec4.
  */
-vec4 operator +(const vec4& left, const vec4& right);
+[[nodiscard]] constexpr vec4 operator +(const vec4& left, const vec4& right) noexcept {
+    return vec4(
+        left.x + right.x,
+        left.y + right.y,
+        left.z + right.z,
+        left.w + right.w
+    );
+}
 
 /** @brief Subtracts a vec4's components by another's.
  *  @param left The left operand.
  *  @param right The right operand.
  *  @return The component-wise subtraction of the first vec4 by the second.
  */
-vec4 operator -(const vec4& left, const vec4& right);
+[[nodiscard]] constexpr vec4 operator -(const vec4& left, const vec4& right) noexcept {
+    return vec4(
+        left.x - right.x,
+        left.y - right.y,
+        left.z - right.z,
+        left.w - right.w
+    );
+}
 
 /** @brief Multiplies a vec4's components by another's.
  *  @param left The left operand.
  *  @param right The right operand.
  *  @return The component-wise product of the two vec4.
  */
-vec4 operator *(const vec4& left, const vec4& right);
+[[nodiscard]] constexpr vec4 operator *(const vec4& left, const vec4& right) noexcept {
+    return vec4(
+        left.x * right.x,
+        left.y * right.y,
+        left.z * right.z,
+        left.w * right.w
+    );
+}
 
 /** @brief Divides a vec4's components by another's.
  *  @param left The left operand.
  *  @param right The right operand.
  *  @return The component-wise division of the first vec4 by the second.
  */
-vec4 operator /(const vec4& left, const vec4& right);
+[[nodiscard]] constexpr vec4 operator /(const vec4& left, const vec4& right) noexcept {
+    return vec4(
+        left.x / right.x,
+        left.y / right.y,
+        left.z / right.z,
+        left.w / right.w
+    );
+}
 
 /** @brief Adds a scalar to each of a vec4's components.
  *  @param vec The vec4.
  *  @param scalar The scalar.
  *  @return The component-wise sum of a vec4 by a scalar.
  */
-vec4 operator +(const vec4& vec, float scalar);
+[[nodiscard]] constexpr vec4 operator +(const vec4& vec, float scalar) noexcept {
+    return vec4(
+        vec.x + scalar,
+        vec.y + scalar,
+        vec.z + scalar,
+        vec.w + scalar
+    );
+}
 
 /** @brief Subtracts each of a vec4's components by a scalar.
  *  @param vec The vec4.
  *  @param scalar The scalar.
  *  @return The component-wise subtraction of a vec4 by a scalar.
  */
-vec4 operator -(const vec4& vec, float scalar);
+[[nodiscard]] constexpr vec4 operator -(const vec4& vec, float scalar) noexcept {
+    return vec4(
+        vec.x - scalar,
+        vec.y - scalar,
+        vec.z - scalar,
+        vec.w - scalar
+    );
+}
 
 /** @brief Multiplies each of a vec4's components by a scalar.
  *  @param vec The vec4.
  *  @param scalar The scalar.
  *  @return The component-wise product of a vec4 by a scalar.
  */
-vec4 operator *(const vec4& vec, float scalar);
+[[nodiscard]] constexpr vec4 operator *(const vec4& vec, float scalar) noexcept {
+    return vec4(
+        vec.x * scalar,
+        vec.y * scalar,
+        vec.z * scalar,
+        vec.w * scalar
+    );
+}
 
 /** @brief Multiplies each of a vec4's components by a scalar.
  *  @param scalar The scalar.
  *  @param vec The vec4.
  *  @return The component-wise product of a vec4 by a scalar.
  */
-vec4 operator *(float scalar, const vec4& vec);
+[[nodiscard]] constexpr vec4 operator *(float scalar, const vec4& vec) noexcept {
+    return vec4(
+        scalar * vec.x,
+        scalar * vec.y,
+        scalar * vec.z,
+        scalar * vec.w
+    );
+}
 
 /** @brief Divides each of a vec4's components by a scalar.
  *  @param vec The vec4.
  *  @param scalar The scalar.
  *  @return The component-wise division of a vec4 by a scalar.
  */
-vec4 operator /(const vec4& vec, float scalar);
+[[nodiscard]] constexpr vec4 operator /(const vec4& vec, float scalar) noexcept {
+    return vec4(
+        vec.x / scalar,
+        vec.y / scalar,
+        vec.z / scalar,
+        vec.w / scalar
+    );
+}
 
 /**
  * @brief Tests whether two vec4 are equal.
@@ -181,7 +306,9 @@ vec4 operator /(const vec4& vec, float scalar);
  * @param right The right operand.
  * @return Whether the two vec4 are equal.
  */
-bool operator ==(const vec4& left, const vec4& right);
+[[nodiscard]] constexpr bool operator ==(const vec4& left, const vec4& right) noexcept {
+    return left.x == right.x && left.y == right.y && left.z == right.z && left.w == right.w;
+}
 
 /**
  * @brief Tests whether two vec4 are different.
@@ -189,4 +316,6 @@ bool operator ==(const vec4& left, const vec4& right);
  * @param right The right operand.
  * @return Whether the two vec4 are different.
  */
-bool operator !=(const vec4& left, const vec4& right);
\ No newline at end of file
+[[nodiscard]] constexpr bool operator !=(const vec4& left, const vec4& right) noexcept {
+    return left.x != right.x || left.y != right.y || left.z != right.z || left.w != right.w;
+}
\ No newline at end of file
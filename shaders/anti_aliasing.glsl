@@ -0,0 +1,85 @@
+/***************************************************************************************************
+ * @file  anti_aliasing.glsl
+ * @brief Implementation of the adaptive anti-aliasing, which only supersamples edges
+ **************************************************************************************************/
+
+#pragma once
+
+#include "render.glsl"
+
+// Must match the AntiAliasing enum of cpu/raymarching.hpp
+const uint ANTI_ALIASING_NONE = 0u;     // One sample per pixel
+const uint ANTI_ALIASING_ADAPTIVE = 1u; // One sample per pixel, 4 on edges
+const uint ANTI_ALIASING_FULL = 2u;     // 4 samples per pixel
+const uint ANTI_ALIASING_TEMPORAL = 3u; // One sample per pixel accumulated over frames
+
+// Must match the RenderPass enum of SampleBuffer.hpp
+const uint RENDER_PASS_SAMPLES = 0u; // Writes one sample per pixel to the sample buffer
+const uint RENDER_PASS_RESOLVE = 1u; // Supersamples the edges found in the sample buffer
+
+const float EDGE_DEPTH_THRESHOLD = 0.1f;  // Relative curvature of the inverse distance
+const float EDGE_NORMAL_THRESHOLD = 0.9f; // Cosine of the angle between two normals
+const float EDGE_COLOR_THRESHOLD = 0.1f;  // Difference of luminance
+
+float luminance(in vec3 color) {
+    return dot(color, vec3(0.299f, 0.587f, 0.114f));
+}
+
+// Rays that started inside a surface travel backwards and misses overshoot MAX_DISTANCE
+float getInverseDistance(in float distance) {
+    return 1.0f / clamp(distance, MIN_DISTANCE, MAX_DISTANCE);
+}
+
+bool isNormalDiscontinuous(in vec3 normal, in vec3 neighbor) {
+    // Normals are zero where they weren't calculated
+    return dot(normal, normal) > 0.0f && dot(neighbor, neighbor) > 0.0f
+           && dot(normal, neighbor) < EDGE_NORMAL_THRESHOLD;
+}
+
+// Compares a sample with its two neighbors along an axis
+bool isEdge(in vec3 color, in vec4 geometry,
+            in vec3 colorA, in vec4 geometryA,
+            in vec3 colorB, in vec4 geometryB) {
+
+    // The inverse distance varies smoothly across a plane, so wide floors aren't flagged while
+    // silhouettes, where it jumps, are
+    float inverse = getInverseDistance(geometry.w);
+    float curvature = abs(getInverseDistance(geometryA.w) + getInverseDistance(geometryB.w)
+                          - 2.0f * inverse);
+    if(curvature > EDGE_DEPTH_THRESHOLD * inverse) {
+        return true;
+    }
+
+    if(isNormalDiscontinuous(geometry.xyz, geometryA.xyz)
+       || isNormalDiscontinuous(geometry.xyz, geometryB.xyz)) {
+        return true;
+    }
+
+    float center = luminance(color);
+    return max(abs(luminance(colorA) - center), abs(luminance(colorB) - center))
+           > EDGE_COLOR_THRESHOLD;
+}
+
+bool isEdge(in ivec2 pixel) {
+    ivec2 last = textureSize(sampleColors, 0) - 1;
+    ivec2 left = ivec2(max(pixel.x - 1, 0), pixel.y);
+    ivec2 right = ivec2(min(pixel.x + 1, last.x), pixel.y);
+    ivec2 bottom = ivec2(pixel.x, max(pixel.y - 1, 0));
+    ivec2 top = ivec2(pixel.x, min(pixel.y + 1, last.y));
+
+    vec3 color = texelFetch(sampleColors, pixel, 0).rgb;
+    vec4 geometry = texelFetch(sampleGeometry, pixel, 0);
+
+    return isEdge(color, geometry,
+                  texelFetch(sampleColors, left, 0).rgb, texelFetch(sampleGeometry, left, 0),
+                  texelFetch(sampleColors, right, 0).rgb, texelFetch(sampleGeometry, right, 0))
+        || isEdge(color, geometry,
+                  texelFetch(sampleColors, bottom, 0).rgb, texelFetch(sampleGeometry, bottom, 0),
+                  texelFetch(sampleColors, top, 0).rgb, texelFetch(sampleGeometry, top, 0));
+}
+
+// Supersamples the pixel if it's on an edge, takes its sample from the sample buffer otherwise
+vec3 resolveAntiAliasing() {
+    ivec2 pixel = ivec2(gl_FragCoord.xy);
+    return isEdge(pixel) ? renderAntiAliasing4() : texelFetch(sampleColors, pixel, 0).rgb;
+}
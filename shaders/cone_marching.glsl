@@ -0,0 +1,30 @@
+/***************************************************************************************************
+ * @file  cone_marching.glsl
+ * @brief Implementation of the cone marching of the depth prepass
+ **************************************************************************************************/
+
+#pragma once
+
+#include "raymarching.glsl"
+
+const int PREPASS_TILE_SIZE = 8; // Must match PREPASS_TILE_SIZE in ConePrepass.hpp
+
+// Marches a cone around a ray for as long as no surface intersects it. Every ray inside the cone
+// can start marching from the returned distance without stepping over a surface.
+float coneMarch(in Ray ray, in float slope) {
+    float distanceFromOrigin = 0.0f;
+
+    for(uint i = 0u ; i < MAX_STEPS ; ++i) {
+        // Distance from the cone's cross-section to the closest surface
+        float distance = mapDistance(ray.origin + ray.direction * distanceFromOrigin)
+                         - slope * distanceFromOrigin;
+
+        if(distance < MIN_DISTANCE || distanceFromOrigin >= MAX_DISTANCE) {
+            break;
+        }
+
+        distanceFromOrigin += distance;
+    }
+
+    return min(distanceFromOrigin, MAX_DISTANCE);
+}
@@ -0,0 +1,77 @@
+/***************************************************************************************************
+ * @file  debug.glsl
+ * @brief Implementation of the debug views showing where the scene is evaluated the most
+ **************************************************************************************************/
+
+#pragma once
+
+#include "render.glsl"
+
+// Must match the DebugView enum of StepHistogram.hpp
+const uint DEBUG_VIEW_NONE = 0u;
+const uint DEBUG_VIEW_MARCH = 1u;
+const uint DEBUG_VIEW_SHADOW = 2u;
+const uint DEBUG_VIEW_OCCLUSION = 3u;
+const uint DEBUG_VIEW_TOTAL = 4u;
+
+// Must match StepHistogram.hpp
+const uint STEP_HISTOGRAM_BIN_COUNT = 64u;
+const uint STEP_HISTOGRAM_BIN_SIZE = 4u;
+
+// The bins of the marching, soft shadow and ambient occlusion passes, one after the other
+layout (std430, binding = 1) buffer StepHistogram {
+    uint stepHistogram[];
+};
+
+// Blue for 0, then cyan, green, yellow and red for 1
+vec3 heatmap(in float t) {
+    t = clamp(t, 0.0f, 1.0f);
+    return clamp(1.5f - abs(4.0f * t - vec3(3.0f, 2.0f, 1.0f)), 0.0f, 1.0f);
+}
+
+void countSteps(in uint pass, in uint steps) {
+    uint bin = min(steps / STEP_HISTOGRAM_BIN_SIZE, STEP_HISTOGRAM_BIN_COUNT - 1u);
+    atomicAdd(stepHistogram[pass * STEP_HISTOGRAM_BIN_COUNT + bin], 1u);
+}
+
+// Counts the evaluations of the scene for the pixel's center, without anti-aliasing, and shows
+// those of the pass chosen by debugView relative to the most that pass can take
+vec3 renderSteps() {
+    vec3 color;
+    uint marchSteps;
+    Ray ray = getRay(vec2(0.0f));
+    float distance = raymarch(ray, getStartDistance(), color, marchSteps);
+    countSteps(0u, marchSteps);
+
+    uint normalSteps = 0u;
+    uint shadowSteps = 0u;
+    uint occlusionSteps = 0u;
+
+    if(hasLighting && distance < MAX_DISTANCE) {
+        vec3 pos = ray.origin + ray.direction * distance;
+        vec3 normal = getNormal(pos);
+        normalSteps = getNormalSampleCount();
+
+        if(hasShadows) {
+            getSoftShadow(pos + normal * 0.02f, shadowSteps);
+            countSteps(1u, shadowSteps);
+        }
+
+        occlusionSteps = OCCLUSION_SAMPLE_COUNT;
+        countSteps(2u, occlusionSteps);
+    }
+
+    uint totalSteps = marchSteps + normalSteps + shadowSteps + occlusionSteps;
+    uint maxSteps = getStepBudget() + getNormalSampleCount() + MAX_STEPS + OCCLUSION_SAMPLE_COUNT;
+
+    switch(debugView) {
+        case DEBUG_VIEW_MARCH:
+            return heatmap(float(marchSteps) / float(getStepBudget()));
+        case DEBUG_VIEW_SHADOW:
+            return heatmap(float(shadowSteps) / float(MAX_STEPS));
+        case DEBUG_VIEW_OCCLUSION:
+            return heatmap(float(occlusionSteps) / float(OCCLUSION_SAMPLE_COUNT));
+        default:
+            return heatmap(float(totalSteps) / float(maxSteps));
+    }
+}
@@ -5,25 +5,44 @@
 
 #version 460 core
 
-out vec4 fragColor;
+layout (location = 0) out vec4 fragColor;
+layout (location = 1) out vec4 fragGeometry; // Only written to the sample and history buffers
 
-uniform vec2 resolution;
-uniform float time;
+#include "uniforms.glsl"
 
-uniform vec3 cameraPos;
-uniform vec3 cameraFront;
-uniform vec3 cameraRight;
-uniform vec3 cameraUp;
-
-uniform uint active_scene;
 uniform bool hasLighting;
+uniform uint normalMethod; // One of the NORMAL constants of lighting.glsl
+uniform uint debugView; // One of the DEBUG_VIEW constants of debug.glsl
 
-const vec3 LIGHT_POSITION = 30.0f * vec3(2.5f, 7.5f, 2.5f);
+uniform bool hasPrepass;
+uniform sampler2D prepassDepth; // Start distance of each tile of pixels, see prepass.frag
 
-bool hasShadows = true;
+uniform uint antiAliasing; // One of the ANTI_ALIASING constants of anti_aliasing.glsl
+uniform uint renderPass;   // One of the RENDER_PASS constants, for the adaptive anti-aliasing
+uniform sampler2D sampleColors;   // One sample per pixel, written by the first pass
+uniform sampler2D sampleGeometry; // The normal and distance of each sample
+uniform sampler2D historyColors;   // The accumulated colors of the previous frame
+uniform sampler2D historyGeometry; // The normal and distance of the previous frame's samples
+
+const vec3 LIGHT_POSITION = 30.0f * vec3(2.5f, 7.5f, 2.5f);
 
 #include "render.glsl"
+#include "debug.glsl"
+#include "anti_aliasing.glsl"
+#include "temporal.glsl"
 
 void main() {
-    fragColor = vec4(renderAntiAliasing4(), 1.0f);
+    if(debugView != DEBUG_VIEW_NONE) {
+        fragColor = vec4(renderSteps(), 1.0f);
+    } else if(antiAliasing == ANTI_ALIASING_FULL) {
+        fragColor = vec4(renderAntiAliasing4(), 1.0f);
+    } else if(antiAliasing == ANTI_ALIASING_TEMPORAL) {
+        fragColor = renderTemporal(fragGeometry);
+    } else if(antiAliasing == ANTI_ALIASING_ADAPTIVE && renderPass == RENDER_PASS_RESOLVE) {
+        fragColor = vec4(resolveAntiAliasing(), 1.0f);
+    } else {
+        vec4 geometry;
+        fragColor = vec4(render(vec2(0.0f), geometry), 1.0f);
+        fragGeometry = geometry;
+    }
 }
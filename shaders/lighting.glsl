@@ -3,18 +3,45 @@
  * @brief Implementation of functions regarding lighting
  **************************************************************************************************/
 
-vec3 getNormal(in vec3 pos) {
+#pragma once
+
+// Must match the NormalMethod enum of cpu/raymarching.hpp
+const uint NORMAL_CENTRAL = 0u;
+const uint NORMAL_TETRAHEDRAL = 1u;
+
+const uint OCCLUSION_SAMPLE_COUNT = 8u;
+
+// Central differences along each axis, 6 samples
+vec3 getCentralNormal(in vec3 pos) {
     vec2 epsilon = vec2(MIN_DISTANCE, 0.0f);
 
     vec3 normal;
-    normal.x = map(pos + epsilon.xyy).w - map(pos - epsilon.xyy).w;
-    normal.y = map(pos + epsilon.yxy).w - map(pos - epsilon.yxy).w;
-    normal.z = map(pos + epsilon.yyx).w - map(pos - epsilon.yyx).w;
+    normal.x = mapDistance(pos + epsilon.xyy) - mapDistance(pos - epsilon.xyy);
+    normal.y = mapDistance(pos + epsilon.yxy) - mapDistance(pos - epsilon.yxy);
+    normal.z = mapDistance(pos + epsilon.yyx) - mapDistance(pos - epsilon.yyx);
 
     return normalize(normal);
 }
 
-float getSoftShadow(vec3 pos) {
+// Differences along the 4 vertices of a tetrahedron, whose sum cancels out the distance at pos
+vec3 getTetrahedralNormal(in vec3 pos) {
+    vec2 k = vec2(1.0f, -1.0f);
+
+    return normalize(k.xyy * mapDistance(pos + k.xyy * MIN_DISTANCE)
+                     + k.yyx * mapDistance(pos + k.yyx * MIN_DISTANCE)
+                     + k.yxy * mapDistance(pos + k.yxy * MIN_DISTANCE)
+                     + k.xxx * mapDistance(pos + k.xxx * MIN_DISTANCE));
+}
+
+vec3 getNormal(in vec3 pos) {
+    return normalMethod == NORMAL_TETRAHEDRAL ? getTetrahedralNormal(pos) : getCentralNormal(pos);
+}
+
+uint getNormalSampleCount() {
+    return normalMethod == NORMAL_TETRAHEDRAL ? 4u : 6u;
+}
+
+float getSoftShadow(vec3 pos, out uint steps) {
     const vec3 lightPos = normalize(LIGHT_POSITION);
     float lightSize = 0.05f;
 
@@ -22,8 +49,10 @@ float getSoftShadow(vec3 pos) {
     float distanceFromOrigin = 0.0f;
     float res = 1.0f;
 
-    for(uint i = 0u; i < MAX_STEPS; ++i) {
-        distance = map(pos + lightPos * distanceFromOrigin).w;
+    for(steps = 0u; steps < MAX_STEPS;) {
+        distance = mapDistance(pos + lightPos * distanceFromOrigin);
+        ++steps;
+
         res = min(res, distance / (distanceFromOrigin * lightSize));
         distanceFromOrigin += distance;
 
@@ -35,22 +64,25 @@ float getSoftShadow(vec3 pos) {
     return clamp(res, 0.0f, 1.0f);
 }
 
+float getSoftShadow(vec3 pos) {
+    uint steps;
+    return getSoftShadow(pos, steps);
+}
+
 float getAmbientOcclusion(in vec3 pos, in vec3 normal) {
     float occlusion = 0.0f;
     float weight = 1.0f;
 
-    for(uint i = 0u ; i < 8u ; ++i) {
+    for(uint i = 0u ; i < OCCLUSION_SAMPLE_COUNT ; ++i) {
         float len = 0.01f + 0.02f * float(i * i);
-        float distance = map(pos + normal * len).w;
+        float distance = mapDistance(pos + normal * len);
         occlusion += (len - distance) * weight;
     }
 
     return 1.0f - clamp(0.6f * occlusion, 0.0f, 1.0f);
 }
 
-vec3 phongLighting(in Ray ray, in vec3 pos) {
-    const vec3 normal = getNormal(pos);
-
+vec3 phongLighting(in Ray ray, in vec3 pos, in vec3 normal) {
     // Ambient Lighting
     float ambient = 0.2f;
 
@@ -3,10 +3,17 @@
  * @brief Implementation of different raymarching scenes
  **************************************************************************************************/
 
+#pragma once
+
 #include "signed_distance_functions.glsl"
 #include "transformations.glsl"
 #include "utility.glsl"
 
+bool hasShadows = true; // Set by the map functions, read by the lighting
+
+// Each mapN function has a mapNDistance variant only returning the distance, for the lighting which
+// doesn't need the colors. Both must always describe the same surfaces.
+
 const vec3 RED = vec3(1.0f, 0.0f, 0.0f);
 const vec3 GREEN = vec3(0.0f, 1.0f, 0.0f);
 const vec3 BLUE = vec3(0.0f, 0.0f, 1.0f);
@@ -32,6 +39,16 @@ vec4 map1(in vec3 pos) {
     return result;
 }
 
+float map1Distance(in vec3 pos) {
+    vec3 p = pos;
+    p.y -= time * 0.5f;
+    p = fract(p) - 0.5f;
+    p.xz *= rotation2D(time);
+    p.zy *= rotation2D(time);
+
+    return min(pos.y, SDF_Box(p, vec3(0.1f)));
+}
+
 vec4 map2(in vec3 pos) {
     hasShadows = false;
 
@@ -61,6 +78,28 @@ vec4 map2(in vec3 pos) {
     return sDifferenceSDF(cube, cylinder, 0.5f);
 }
 
+float map2Distance(in vec3 pos) {
+    vec3 p;
+
+    float repetition = 12.0f;
+    float radius = 2.0f;
+    vec3 translation = 5.5f * vec3(radius, 0.0f, radius);
+
+    p = mod(pos + translation, repetition) - 0.25f * repetition;
+    float cylinder = SDF_Cylinder(p, vec3(radius));
+
+    p = mod(pos.zxy + translation, repetition) - 0.25f * repetition;
+    cylinder = smin(cylinder, SDF_Cylinder(p, vec3(radius)), 0.1f);
+
+    p = mod(pos.yzx + translation, repetition) - 0.25f * repetition;
+    cylinder = smin(cylinder, SDF_Cylinder(p, vec3(radius)), 0.1f);
+
+    p = mod(pos, repetition) - 0.5f * repetition;
+    float cube = -SDF_RoundBox(p, vec3(4.0f), 1.0f);
+
+    return smax(cube, -cylinder, 0.5f);
+}
+
 vec4 map3(in vec3 pos) {
     vec3 p = pos;
 
@@ -83,6 +122,23 @@ vec4 map3(in vec3 pos) {
     return sDifferenceSDF(ground, cylinder, 0.5f);
 }
 
+float map3Distance(in vec3 pos) {
+    vec3 p = pos;
+    p.xz += vec2(time);
+    p.xy *= rotation2D(radians(90.0f));
+    p.yz = mod(p.yz, 2.0f) - 0.5f;
+    float cylinder = SDF_Cylinder(p, vec3(0.5f));
+
+    p = pos;
+    p.zy *= rotation2D(radians(90.0f));
+    p.xy = mod(p.xy, 2.0f) - 0.5f;
+    cylinder = smin(cylinder, SDF_Cylinder(p, vec3(0.5f)), 0.2f);
+
+    float ground = SDF_Plane(pos, vec3(0.0f, 1.0f, 0.0f), 0.5f + 0.5f * sin(time));
+
+    return smax(ground, -cylinder, 0.5f);
+}
+
 vec4 map4(in vec3 pos) {
     hasShadows = false;
 
@@ -93,6 +149,7 @@ vec4 map4(in vec3 pos) {
 
     float distance = 8.0f;
     float smoothing = 1.0f;
+    float radius = 3.75f; // Bounding sphere of a group, the reach of the smooth unions included
 
     vec4 result;
 
@@ -101,52 +158,136 @@ vec4 map4(in vec3 pos) {
     result = box;
 
     p = pos - vec3(-distance, -2.0f * -distance, 0.0f);
-    beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
-    beams.w = min(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
-    beams.w = min(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
-    result = unionSDF(result, beams);
+    if(!isCulled(SDF_Sphere(p, radius), result.w)) {
+        beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
+        beams.w = min(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
+        beams.w = min(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = unionSDF(result, beams);
+    }
 
     p = pos - vec3(-distance, 0.0f, 0.0f);
-    box.w = SDF_Box(p, vec3(2.0f));
-    beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
-    beams.w = min(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
-    beams.w = min(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
-    result = unionSDF(result, unionSDF(box, beams));
+    if(!isCulled(SDF_Sphere(p, radius), result.w)) {
+        box.w = SDF_Box(p, vec3(2.0f));
+        beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
+        beams.w = min(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
+        beams.w = min(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = unionSDF(result, unionSDF(box, beams));
+    }
 
     p = pos;
-    box.w = SDF_Box(p, vec3(2.0f));
-    beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
-    beams.w = min(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
-    beams.w = min(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
-    result = unionSDF(result, intersectSDF(box, beams));
+    if(!isCulled(SDF_Sphere(p, radius), result.w)) {
+        box.w = SDF_Box(p, vec3(2.0f));
+        beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
+        beams.w = min(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
+        beams.w = min(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = unionSDF(result, intersectSDF(box, beams));
+    }
 
     p = pos - vec3(distance, 0.0f, 0.0f);
-    box.w = SDF_Box(p, vec3(2.0f));
-    beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
-    beams.w = min(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
-    beams.w = min(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
-    result = unionSDF(result, differenceSDF(box, beams));
+    if(!isCulled(SDF_Sphere(p, radius), result.w)) {
+        box.w = SDF_Box(p, vec3(2.0f));
+        beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
+        beams.w = min(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
+        beams.w = min(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = unionSDF(result, differenceSDF(box, beams));
+    }
 
     p = pos - vec3(-distance, distance, 0.0f);
-    box.w = SDF_Box(p, vec3(2.0f));
-    beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
-    beams.w = min(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
-    beams.w = min(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
-    result = unionSDF(result, sUnionSDF(box, beams, smoothing));
+    if(!isCulled(SDF_Sphere(p, radius), result.w)) {
+        box.w = SDF_Box(p, vec3(2.0f));
+        beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
+        beams.w = min(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
+        beams.w = min(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = unionSDF(result, sUnionSDF(box, beams, smoothing));
+    }
 
     p = pos - vec3(0.0f, distance, 0.0f);
-    box.w = SDF_Box(p, vec3(2.0f));
-    beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
-    beams.w = min(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
-    beams.w = min(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
-    result = unionSDF(result, sIntersectSDF(box, beams, smoothing));
+    if(!isCulled(SDF_Sphere(p, radius), result.w)) {
+        box.w = SDF_Box(p, vec3(2.0f));
+        beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
+        beams.w = min(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
+        beams.w = min(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = unionSDF(result, sIntersectSDF(box, beams, smoothing));
+    }
 
     p = pos - vec3(distance, distance, 0.0f);
-    box.w = SDF_Box(p, vec3(2.0f));
-    beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
-    beams.w = min(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
-    beams.w = min(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
-    result = unionSDF(result, sDifferenceSDF(box, beams, smoothing));
+    if(!isCulled(SDF_Sphere(p, radius), result.w)) {
+        box.w = SDF_Box(p, vec3(2.0f));
+        beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
+        beams.w = min(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
+        beams.w = min(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = unionSDF(result, sDifferenceSDF(box, beams, smoothing));
+    }
+
+    return result;
+}
+
+float map4Distance(in vec3 pos) {
+    vec3 p;
+
+    float distance = 8.0f;
+    float smoothing = 1.0f;
+    float radius = 3.75f; // Bounding sphere of a group, see map4
+
+    float box, beams;
+
+    p = pos - vec3(distance, -2.0f * -distance, 0.0f);
+    float result = SDF_Box(p, vec3(2.0f));
+
+    p = pos - vec3(-distance, -2.0f * -distance, 0.0f);
+    if(!isCulled(SDF_Sphere(p, radius), result)) {
+        beams = min3(SDF_Box(p, vec3(1.0f, 3.0f, 1.0f)), SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)),
+                     SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = min(result, beams);
+    }
+
+    p = pos - vec3(-distance, 0.0f, 0.0f);
+    if(!isCulled(SDF_Sphere(p, radius), result)) {
+        box = SDF_Box(p, vec3(2.0f));
+        beams = min3(SDF_Box(p, vec3(1.0f, 3.0f, 1.0f)), SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)),
+                     SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = min(result, min(box, beams));
+    }
+
+    p = pos;
+    if(!isCulled(SDF_Sphere(p, radius), result)) {
+        box = SDF_Box(p, vec3(2.0f));
+        beams = min3(SDF_Box(p, vec3(1.0f, 3.0f, 1.0f)), SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)),
+                     SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = min(result, max(box, beams));
+    }
+
+    p = pos - vec3(distance, 0.0f, 0.0f);
+    if(!isCulled(SDF_Sphere(p, radius), result)) {
+        box = SDF_Box(p, vec3(2.0f));
+        beams = min3(SDF_Box(p, vec3(1.0f, 3.0f, 1.0f)), SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)),
+                     SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = min(result, max(box, -beams));
+    }
+
+    p = pos - vec3(-distance, distance, 0.0f);
+    if(!isCulled(SDF_Sphere(p, radius), result)) {
+        box = SDF_Box(p, vec3(2.0f));
+        beams = min3(SDF_Box(p, vec3(1.0f, 3.0f, 1.0f)), SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)),
+                     SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = min(result, smin(box, beams, smoothing));
+    }
+
+    p = pos - vec3(0.0f, distance, 0.0f);
+    if(!isCulled(SDF_Sphere(p, radius), result)) {
+        box = SDF_Box(p, vec3(2.0f));
+        beams = min3(SDF_Box(p, vec3(1.0f, 3.0f, 1.0f)), SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)),
+                     SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = min(result, smax(box, beams, smoothing));
+    }
+
+    p = pos - vec3(distance, distance, 0.0f);
+    if(!isCulled(SDF_Sphere(p, radius), result)) {
+        box = SDF_Box(p, vec3(2.0f));
+        beams = min3(SDF_Box(p, vec3(1.0f, 3.0f, 1.0f)), SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)),
+                     SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = min(result, smax(box, -beams, smoothing));
+    }
 
     return result;
 }
@@ -160,6 +301,10 @@ vec4 map5(in vec3 pos) {
     return ground;
 }
 
+float map5Distance(in vec3 pos) {
+    return SDF_Plane(pos, vec3(0.0f, 1.0f, 0.0f), 1.0f);
+}
+
 vec4 map6(in vec3 pos) {
     hasShadows = false;
 
@@ -177,6 +322,17 @@ vec4 map6(in vec3 pos) {
     return differenceSDF(cube, cross);
 }
 
+float map6Distance(in vec3 pos) {
+    float l = 1.0f, s = 4.0f;
+    pos = pos - s * clamp(round(pos / s), -l, l);
+    float cube = SDF_Sphere(pos, 1.0f);
+
+    vec3 dim = vec3(0.4f, 1.5f, 0.4f);
+    float cross = min3(SDF_Box(pos, dim.xyz), SDF_Box(pos, dim.yzx), SDF_Box(pos, dim.zxy));
+
+    return max(cube, -cross);
+}
+
 vec4 map7(in vec3 pos) {
     vec3 p = pos;
     vec4 ground;
@@ -210,17 +366,44 @@ vec4 map7(in vec3 pos) {
     return result;
 }
 
+float map7Distance(in vec3 pos) {
+    vec3 p = pos;
+    float ground = SDF_Plane(p, GREEN, 0.5f + 0.5f * sin(time));
+
+    p = pos;
+    p.y += 0.5f;
+    p.xy *= rotation2D(radians(90.0f));
+    p.yz = mod(p.yz, 2.0f) - 1.0f;
+    float cube = SDF_Box(p, vec3(0.5f));
+
+    p = pos;
+    p.y -= time;
+    p.xz = mod(p.xz, 2.0f) - 1.0f;
+    p.y = mod(p.y, 4.0f) - 2.0f;
+    float sphere = SDF_Sphere(p, 0.25f);
+
+    float ceiling = SDF_Plane(pos, vec3(0.0f, -1.0f, 0.0f), 4.0f);
+
+    return smin(smax(ground, -cube, 0.25f), max(sphere, -ceiling), 0.25f);
+}
+
 vec4 map8(in vec3 pos) {
     vec3 p = pos;
 
     vec4 ground = vec4(0.545f, 0.851f, 0.42f, p.y);
+    vec4 result = ground;
 
+    // The outer walls of the house bound everything else
     p = pos;
     p.y -= 5.0f;
     vec4 house;
     house.rgb = vec3(0.6f, 0.565f, 0.506f);
     house.w = SDF_Box(p, vec3(5.0f));
 
+    if(isCulled(house.w, result.w)) {
+        return result;
+    }
+
     p = pos;
     p.y -= 4.05f;
     house.w = max(house.w, -SDF_Box(p, vec3(4.0f)));
@@ -228,6 +411,13 @@ vec4 map8(in vec3 pos) {
     p = pos - vec3(0.0f, 3.05f, 5.0f);
     house.w = max(house.w, -SDF_Box(p, vec3(2.0f, 3.0f, 2.0f)));
 
+    result = unionSDF(result, house);
+
+    p = pos - vec3(0.0f, 3.5f, 0.0f);
+    if(isCulled(SDF_Sphere(p, 3.6f), result.w)) {
+        return result;
+    }
+
     p = pos;
     p.y -= 1.5f;
     vec4 snowman;
@@ -251,13 +441,58 @@ vec4 map8(in vec3 pos) {
     nose.rgb = vec3(0.871f, 0.584f, 0.184f);
     nose.w = SDF_Cone(p, vec2(sin(radians(7.5)), cos(radians(7.5))), 0.5f);
 
-    vec4 result = ground;
-    result = unionSDF(result, house);
     result = unionSDF(result, sUnionSDF(snowman, unionSDF(eyes, nose), 0.01f));
 
     return result;
 }
 
+float map8Distance(in vec3 pos) {
+    vec3 p = pos;
+
+    float result = p.y;
+
+    p = pos;
+    p.y -= 5.0f;
+    float house = SDF_Box(p, vec3(5.0f));
+
+    if(isCulled(house, result)) {
+        return result;
+    }
+
+    p = pos;
+    p.y -= 4.05f;
+    house = max(house, -SDF_Box(p, vec3(4.0f)));
+
+    p = pos - vec3(0.0f, 3.05f, 5.0f);
+    house = max(house, -SDF_Box(p, vec3(2.0f, 3.0f, 2.0f)));
+
+    result = min(result, house);
+
+    p = pos - vec3(0.0f, 3.5f, 0.0f);
+    if(isCulled(SDF_Sphere(p, 3.6f), result)) {
+        return result;
+    }
+
+    p = pos;
+    p.y -= 1.5f;
+    float snowman = SDF_Sphere(p, 1.5f);
+
+    p.y -= 2.25f;
+    snowman = smin(snowman, SDF_Sphere(p, 1.0f), 0.15f);
+
+    p.y -= 1.5f;
+    snowman = smin(snowman, SDF_Sphere(p, 0.6f), 0.15f);
+
+    float eyes = min(SDF_Sphere(pos - vec3(0.3f, 5.4f, 0.5f), 0.05f),
+                     SDF_Sphere(pos - vec3(-0.3f, 5.4f, 0.5f), 0.05f));
+
+    p = pos - vec3(0.0f, 5.25f, 1.1f);
+    p.zy *= rotation2D(radians(90.0f));
+    float nose = SDF_Cone(p, vec2(sin(radians(7.5)), cos(radians(7.5))), 0.5f);
+
+    return min(result, smin(snowman, min(eyes, nose), 0.01f));
+}
+
 vec4 map9(in vec3 pos) {
     vec3 p = pos;
     vec4 ground = vec4(1.0f, 1.0f, 1.0f, p.y + 1.0f);
@@ -292,6 +527,29 @@ vec4 map9(in vec3 pos) {
     return result;
 }
 
+float map9Distance(in vec3 pos) {
+    vec3 p = pos;
+    float ground = p.y + 1.0f;
+
+    float sphere = SDF_Sphere(pos, 1.5f);
+
+    p = pos;
+    p.y -= 1.0f + sin(time);
+    float cube = SDF_RoundBox(p, vec3(1.0f), 0.1f);
+
+    p = pos;
+    p.x -= 1.0f + sin(time);
+    float cube2 = SDF_RoundBox(p, vec3(1.0f), 0.1f);
+
+    p = pos;
+    p.x += 1.0f + sin(time);
+    float cube3 = SDF_RoundBox(p, vec3(1.0f), 0.1f);
+
+    cube = smin(cube, smin(cube2, cube3, 0.5f), 0.5f);
+
+    return min(ground, smin(sphere, cube, 0.5f));
+}
+
 vec4 map10(in vec3 pos) {
     vec3 p = pos;
 
@@ -310,25 +568,65 @@ vec4 map10(in vec3 pos) {
     return result;
 }
 
+float map10Distance(in vec3 pos) {
+    vec3 p = pos;
+
+    vec3 factor = time * vec3(2.0f, 0.5f, 3.0f);
+    float displacement = sin(p.x + factor.x) * sin(p.y + factor.y) * sin(p.z + factor.z);
+
+    return min(p.y + 10.0f, SDF_Sphere(p, 10.0f + displacement));
+}
+
 vec4 map11(in vec3 pos) {
+    float R = 50.0f;
+
+    // Distances to the circles of the tori, their tubes being added once the radius is known
+    vec3 circles;
+    circles.x = SDF_Torus(pos - vec3(-R / 2.0f, 0.0f, 0.0f), R, 0.0f);
+    circles.y = SDF_Torus(pos - vec3(R / 2.0f, 0.0f, 0.0f), R, 0.0f);
+    circles.z = SDF_Torus(pos.xzy, R, 0.0f);
+
+    // The displacement keeps the tubes' radius under 3 and the smooth unions reach 0.25 further.
+    // Nothing else is in the scene so the tori are only evaluated within 1 of that bound.
+    float bound = min3(circles.x, circles.y, circles.z) - 3.25f;
+    if(isCulled(bound, 1.0f)) {
+        return vec4(BLUE, bound);
+    }
+
     vec3 p = pos;
 
     float displacement = sin(p.x + 2.0f * time) * sin(p.y + sin(0.25f * time)) * sin(p.z + 3.0f * time);
-    float R = 50.0f, r = 2.0f + displacement;
+    float r = 2.0f + displacement;
 
     vec4 torus;
     torus.rgb = mix(BLUE, GREEN, 0.5f + 0.5f * displacement);
+    torus.w = circles.x - r;
 
-    p = pos - vec3(-R / 2.0f, 0.0f, 0.0f);
-    torus.w = SDF_Torus(p, R, r);
+    torus = sUnionSDF(torus, vec4(torus.grb, circles.y - r), 0.5f);
+    torus = sUnionSDF(torus, vec4(torus.rgb, circles.z - r), 0.5f);
 
-    p = pos - vec3(R / 2.0f, 0.0f, 0.0f);
-    torus = sUnionSDF(torus, vec4(torus.grb, SDF_Torus(p, R, r)), 0.5f);
+    return torus;
+}
 
-    p = pos.xzy;
-    torus = sUnionSDF(torus, vec4(torus.rgb, SDF_Torus(p, R, r)), 0.5f);
+float map11Distance(in vec3 pos) {
+    float R = 50.0f;
 
-    return torus;
+    float circleX = SDF_Torus(pos - vec3(-R / 2.0f, 0.0f, 0.0f), R, 0.0f);
+    float circleY = SDF_Torus(pos - vec3(R / 2.0f, 0.0f, 0.0f), R, 0.0f);
+    float circleZ = SDF_Torus(pos.xzy, R, 0.0f);
+
+    // See map11
+    float bound = min3(circleX, circleY, circleZ) - 3.25f;
+    if(isCulled(bound, 1.0f)) {
+        return bound;
+    }
+
+    vec3 p = pos;
+
+    float displacement = sin(p.x + 2.0f * time) * sin(p.y + sin(0.25f * time)) * sin(p.z + 3.0f * time);
+    float r = 2.0f + displacement;
+
+    return smin(smin(circleX - r, circleY - r, 0.5f), circleZ - r, 0.5f);
 }
 
 vec4 map12(in vec3 pos) {
@@ -343,4 +641,11 @@ vec4 map12(in vec3 pos) {
     vec4 result = box;
 
     return result;
+}
+
+float map12Distance(in vec3 pos) {
+    vec3 p = pos;
+    p.y += 1.0f;
+
+    return SDF_Box(p, vec3(8.0f, 1.0f, 8.0f));
 }
\ No newline at end of file
@@ -0,0 +1,40 @@
+/***************************************************************************************************
+ * @file  overlay.frag
+ * @brief Draws the graph of the last GPU frame times in a corner of the screen
+ **************************************************************************************************/
+
+#version 460 core
+
+out vec4 fragColor;
+
+const uint FRAME_COUNT = 128u; // Must match OVERLAY_FRAME_COUNT in Application.hpp
+
+uniform vec2 origin;  // Bottom left corner of the graph in pixels
+uniform vec2 size;    // Size of the graph in pixels
+uniform float maxTime; // Frame time at the top of the graph in milliseconds
+
+uniform float frameTimes[FRAME_COUNT]; // Ring of frame times in milliseconds
+uniform uint latest;                   // Index of the most recent frame time
+
+void main() {
+    vec2 uv = (gl_FragCoord.xy - origin) / size;
+
+    // Oldest frame on the left, most recent on the right
+    uint column = min(uint(uv.x * float(FRAME_COUNT)), FRAME_COUNT - 1u);
+    float frameTime = frameTimes[(latest + 1u + column) % FRAME_COUNT];
+
+    float pixel = maxTime / size.y;
+    float y = uv.y * maxTime;
+
+    if(y < frameTime) {
+        // Green under 60 fps, yellow under 30 fps and red above
+        vec3 color = frameTime < 1000.0f / 60.0f ? vec3(0.2f, 0.9f, 0.3f)
+                   : frameTime < 1000.0f / 30.0f ? vec3(0.95f, 0.8f, 0.2f)
+                   : vec3(0.95f, 0.25f, 0.2f);
+        fragColor = vec4(color, 0.85f);
+    } else if(abs(y - 1000.0f / 60.0f) < pixel || abs(y - 1000.0f / 30.0f) < pixel) {
+        fragColor = vec4(1.0f, 1.0f, 1.0f, 0.6f);
+    } else {
+        fragColor = vec4(0.0f, 0.0f, 0.0f, 0.5f);
+    }
+}
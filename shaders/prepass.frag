@@ -0,0 +1,24 @@
+/***************************************************************************************************
+ * @file  prepass.frag
+ * @brief Writes the distance the rays of each tile of pixels can start marching from
+ **************************************************************************************************/
+
+#version 460 core
+
+out float startDistance;
+
+#include "uniforms.glsl"
+#include "cone_marching.glsl"
+
+void main() {
+    // Each fragment covers a tile of pixels of the main pass
+    vec2 center = gl_FragCoord.xy * float(PREPASS_TILE_SIZE);
+    vec2 uv = (2.0f * center - resolution) / resolution.y;
+
+    // Half the tile's diagonal in uv units, widened by a pixel for the anti-aliasing samples. The
+    // ray directions are at least 1 long before being normalized so this bounds the cone's angle.
+    float slope = float(PREPASS_TILE_SIZE + 1) * sqrt(2.0f) / resolution.y;
+
+    Ray ray = Ray(cameraPos, normalize(cameraFront + uv.x * cameraRight + uv.y * cameraUp));
+    startDistance = coneMarch(ray, slope);
+}
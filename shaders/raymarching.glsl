@@ -3,11 +3,23 @@
  * @brief Implementation of functions regarding raymarching
  **************************************************************************************************/
 
+#pragma once
+
 #include "maps.glsl"
 
 const uint MAX_STEPS = 256u;
 const float MIN_DISTANCE = 0.001f;
 const float MAX_DISTANCE = 500.0f;
+const float HIT_FOOTPRINT = 0.5f; // Fraction of a pixel's footprint a hit must be closer than
+
+// Over-relaxation factor of each scene, 1 for plain sphere tracing, chosen with --compare-steps.
+// map1's tiny repeated boxes and map10's displacement only get artefacts or extra steps from it.
+const float RELAXATION[12] = float[](1.0f, 1.4f, 1.4f, 1.2f, 1.6f, 1.2f,
+                                     1.2f, 1.2f, 1.4f, 1.0f, 1.2f, 1.4f);
+
+// Maximum number of steps of a ray in each scene, measured with a margin over the rays that converge
+const uint STEP_BUDGET[12] = uint[](256u, 256u, 192u, 96u, 128u, 96u,
+                                    256u, 64u, 192u, 96u, 160u, 64u);
 
 struct Ray {
     vec3 origin;
@@ -17,6 +29,36 @@ struct Ray {
 vec4 map(in vec3 pos) {
     hasShadows = true;
 
+#ifdef SCENE
+    // Specialized program: only the map function of its scene is kept
+#if SCENE == 0
+    return map1(pos);
+#elif SCENE == 1
+    return map2(pos);
+#elif SCENE == 2
+    return map3(pos);
+#elif SCENE == 3
+    return map4(pos);
+#elif SCENE == 4
+    return map5(pos);
+#elif SCENE == 5
+    return map6(pos);
+#elif SCENE == 6
+    return map7(pos);
+#elif SCENE == 7
+    return map8(pos);
+#elif SCENE == 8
+    return map9(pos);
+#elif SCENE == 9
+    return map10(pos);
+#elif SCENE == 10
+    return map11(pos);
+#elif SCENE == 11
+    return map12(pos);
+#else
+    return map1(pos);
+#endif
+#else
     switch(active_scene) {
         case 0u: return map1(pos);
         case 1u: return map2(pos);
@@ -32,23 +74,136 @@ vec4 map(in vec3 pos) {
         case 11u: return map12(pos);
         default: return map1(pos);
     }
+#endif
 }
 
-float raymarch(in Ray ray, inout vec3 color) {
+float mapDistance(in vec3 pos) {
+#ifdef SCENE
+#if SCENE == 0
+    return map1Distance(pos);
+#elif SCENE == 1
+    return map2Distance(pos);
+#elif SCENE == 2
+    return map3Distance(pos);
+#elif SCENE == 3
+    return map4Distance(pos);
+#elif SCENE == 4
+    return map5Distance(pos);
+#elif SCENE == 5
+    return map6Distance(pos);
+#elif SCENE == 6
+    return map7Distance(pos);
+#elif SCENE == 7
+    return map8Distance(pos);
+#elif SCENE == 8
+    return map9Distance(pos);
+#elif SCENE == 9
+    return map10Distance(pos);
+#elif SCENE == 10
+    return map11Distance(pos);
+#elif SCENE == 11
+    return map12Distance(pos);
+#else
+    return map1Distance(pos);
+#endif
+#else
+    switch(active_scene) {
+        case 0u: return map1Distance(pos);
+        case 1u: return map2Distance(pos);
+        case 2u: return map3Distance(pos);
+        case 3u: return map4Distance(pos);
+        case 4u: return map5Distance(pos);
+        case 5u: return map6Distance(pos);
+        case 6u: return map7Distance(pos);
+        case 7u: return map8Distance(pos);
+        case 8u: return map9Distance(pos);
+        case 9u: return map10Distance(pos);
+        case 10u: return map11Distance(pos);
+        case 11u: return map12Distance(pos);
+        default: return map1Distance(pos);
+    }
+#endif
+}
+
+float getRelaxation() {
+    if(!isRelaxed) {
+        return 1.0f;
+    }
+
+#ifdef SCENE
+    return RELAXATION[SCENE];
+#else
+    return active_scene < 12u ? RELAXATION[active_scene] : 1.0f;
+#endif
+}
+
+uint getStepBudget() {
+    if(!isHitAdaptive) {
+        return MAX_STEPS;
+    }
+
+#ifdef SCENE
+    return STEP_BUDGET[SCENE];
+#else
+    return active_scene < 12u ? STEP_BUDGET[active_scene] : MAX_STEPS;
+#endif
+}
+
+// Grows with the pixel's footprint, which is 2 / resolution.y wide at a distance of 1 from the
+// camera, so far rays stop as soon as they are closer than a fraction of a pixel
+float getHitDistance(in float distanceFromOrigin) {
+    if(!isHitAdaptive) {
+        return MIN_DISTANCE;
+    }
+
+    return max(MIN_DISTANCE, HIT_FOOTPRINT * 2.0f * distanceFromOrigin / resolution.y);
+}
+
+// Over-relaxed sphere tracing: steps are scaled by the relaxation factor as long as the unbounding
+// spheres of consecutive samples overlap. When they don't, a surface may have been stepped over so
+// the ray goes back to where plain sphere tracing would have been and carries on without relaxation.
+float raymarch(in Ray ray, in float start, inout vec3 color, out uint steps) {
+    uint stepBudget = getStepBudget();
+    float relaxation = getRelaxation();
+
     vec4 distance;
-    float distanceFromOrigin = 0.0f;
+    float distanceFromOrigin = start;
+    float previousRadius = 0.0f;
+    float stepLength = 0.0f;
 
-    for(uint i = 0u ; i < MAX_STEPS ; ++i) {
+    for(steps = 0u ; steps < stepBudget ;) {
         distance = map(ray.origin + ray.direction * distanceFromOrigin);
-        distanceFromOrigin += distance.w;
+        ++steps;
 
-        if(abs(distance.w) < MIN_DISTANCE || distanceFromOrigin >= MAX_DISTANCE) {
+        float radius = abs(distance.w);
+
+        if(relaxation > 1.0f && radius + previousRadius < stepLength) {
+            distanceFromOrigin -= stepLength - stepLength / relaxation;
+            relaxation = 1.0f;
+            continue;
+        }
+
+        stepLength = relaxation * distance.w;
+        previousRadius = radius;
+        distanceFromOrigin += stepLength;
+
+        if(radius < getHitDistance(distanceFromOrigin) || distanceFromOrigin >= MAX_DISTANCE) {
             color = distance.rgb;
-            break;
+            return distanceFromOrigin;
         }
     }
 
-    return distanceFromOrigin;
+    // Rays that run out of steps haven't found a surface
+    return MAX_DISTANCE;
+}
+
+float raymarch(in Ray ray, in float start, inout vec3 color) {
+    uint steps;
+    return raymarch(ray, start, color, steps);
+}
+
+float raymarch(in Ray ray, inout vec3 color) {
+    return raymarch(ray, 0.0f, color);
 }
 
 float raymarch(in vec3 rayOrigin, in vec3 rayDirection) {
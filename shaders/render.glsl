@@ -3,24 +3,43 @@
  * @brief Implementation of functions regarding rendering
  **************************************************************************************************/
 
+#pragma once
+
 #include "raymarching.glsl"
 #include "lighting.glsl"
+#include "cone_marching.glsl"
 
 vec2 getUV(in vec2 offset) {
     return (2.0f * (gl_FragCoord.xy + offset) - resolution) / resolution.y;
 }
 
-vec3 render(in vec2 uvOffset) {
+Ray getRay(in vec2 uvOffset) {
+    vec2 uv = getUV(uvOffset);
+    return Ray(cameraPos, normalize(cameraFront + uv.x * cameraRight + uv.y * cameraUp));
+}
+
+float getStartDistance() {
+    return hasPrepass
+           ? texelFetch(prepassDepth, ivec2(gl_FragCoord.xy) / PREPASS_TILE_SIZE, 0).r
+           : 0.0f;
+}
+
+// The geometry holds the normal of the surface in xyz, or zeros where it isn't needed, and the
+// distance the ray travelled in w
+vec3 render(in vec2 uvOffset, out vec4 geometry) {
     const vec3 background = vec3(0.125f, 0.5f, 0.8f);
     vec3 color = background;
 
-    vec2 uv = getUV(uvOffset);
-    Ray ray = Ray(cameraPos, normalize(cameraFront + uv.x * cameraRight + uv.y * cameraUp));
-    float distance = raymarch(ray, color);
+    Ray ray = getRay(uvOffset);
+    float distance = raymarch(ray, getStartDistance(), color);
+    geometry = vec4(0.0f, 0.0f, 0.0f, distance);
 
     if(distance < MAX_DISTANCE) {
         if(hasLighting) {
-            color *= phongLighting(ray, ray.origin + ray.direction * distance);
+            vec3 pos = ray.origin + ray.direction * distance;
+            geometry.xyz = getNormal(pos);
+
+            color *= phongLighting(ray, pos, geometry.xyz);
             color = mix(background, color, exp(-0.00002f * distance * distance)); // fog
         } else {
             color *= vec3(0.15f * distance);
@@ -32,6 +51,11 @@ vec3 render(in vec2 uvOffset) {
     return color;
 }
 
+vec3 render(in vec2 uvOffset) {
+    vec4 geometry;
+    return render(uvOffset, geometry);
+}
+
 vec3 renderAntiAliasing4() {
     vec4 e = vec4(0.125f, -0.125f, 0.375f, -0.375f);
     return 0.25f * (render(e.xz) + render(e.yw) + render(e.wx) + render(e.zy));
@@ -3,6 +3,8 @@
  * @brief Implementation of signed distance functions
  **************************************************************************************************/
 
+#pragma once
+
 float SDF_Plane(in vec3 pos, in vec3 normal, in float height) {
     return dot(pos, normalize(normal)) + height;
 }
@@ -0,0 +1,94 @@
+/***************************************************************************************************
+ * @file  temporal.glsl
+ * @brief Implementation of the temporal accumulation, which spreads the samples over frames
+ **************************************************************************************************/
+
+#pragma once
+
+#include "render.glsl"
+
+// Most samples the history of a pixel averages. Resampling the history between pixels blurs it so
+// moving pixels keep fewer.
+const float TEMPORAL_STILL_SAMPLE_COUNT = 16.0f;
+const float TEMPORAL_MOVING_SAMPLE_COUNT = 4.0f;
+const float TEMPORAL_MOTION_THRESHOLD = 0.01f; // In pixels, below which a pixel is still
+const float TEMPORAL_DEPTH_THRESHOLD = 0.05f;  // Relative difference of distance rejecting history
+
+// Cycles through the offsets of renderAntiAliasing4 so still pixels converge to the same result
+vec2 getJitter() {
+    vec4 e = vec4(0.125f, -0.125f, 0.375f, -0.375f);
+
+    switch(frame % 4u) {
+        case 0u: return e.xz;
+        case 1u: return e.yw;
+        case 2u: return e.wx;
+        default: return e.zy;
+    }
+}
+
+// Finds where the surface seen through the pixel was in the previous frame. The pixel's center is
+// reprojected rather than its sample so that still pixels read their own history without blur.
+// Returns false if the surface was behind the previous camera or outside of its frame.
+bool reproject(in float distance, out vec2 fragCoord, out float previousDistance) {
+    vec3 direction = getRay(vec2(0.0f)).direction;
+
+    // Misses are reprojected like points at infinity, which only the camera's rotation moves
+    vec3 toSurface = distance < MAX_DISTANCE
+                     ? cameraPos + direction * distance - previousCameraPos
+                     : direction;
+    previousDistance = distance < MAX_DISTANCE ? length(toSurface) : MAX_DISTANCE;
+
+    float depth = dot(toSurface, previousCameraFront);
+    if(depth <= 0.0f) {
+        return false;
+    }
+
+    vec2 uv = vec2(dot(toSurface, previousCameraRight), dot(toSurface, previousCameraUp)) / depth;
+    fragCoord = 0.5f * (uv * resolution.y + resolution);
+
+    return all(greaterThanEqual(fragCoord, vec2(0.0f))) && all(lessThan(fragCoord, resolution));
+}
+
+// Whether a surface at a distance from the previous camera was visible around a pixel of the
+// previous frame. The neighbors are included since the samples of an edge pixel can hit the
+// surfaces on both sides of it.
+bool isInHistory(in ivec2 pixel, in float distance) {
+    ivec2 last = textureSize(historyGeometry, 0) - 1;
+    distance = clamp(distance, MIN_DISTANCE, MAX_DISTANCE);
+
+    for(int y = -1 ; y <= 1 ; ++y) {
+        for(int x = -1 ; x <= 1 ; ++x) {
+            ivec2 neighbor = clamp(pixel + ivec2(x, y), ivec2(0), last);
+            float previous = clamp(texelFetch(historyGeometry, neighbor, 0).w,
+                                   MIN_DISTANCE, MAX_DISTANCE);
+
+            if(abs(previous - distance) <= TEMPORAL_DEPTH_THRESHOLD * distance) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+// Blends a new sample into the history of the pixel. The count of samples the color averages is
+// kept in alpha and restarts from 1 where the history is rejected.
+vec4 renderTemporal(out vec4 geometry) {
+    vec3 color = render(getJitter(), geometry);
+
+    // A surface missing from the history was hidden or outside of the previous frame
+    vec2 previous;
+    float previousDistance;
+    if(!reproject(geometry.w, previous, previousDistance)
+       || !isInHistory(ivec2(previous), previousDistance)) {
+        return vec4(color, 1.0f);
+    }
+
+    vec4 history = texture(historyColors, previous / resolution);
+    float maxCount = distance(previous, gl_FragCoord.xy) < TEMPORAL_MOTION_THRESHOLD
+                     ? TEMPORAL_STILL_SAMPLE_COUNT
+                     : TEMPORAL_MOVING_SAMPLE_COUNT;
+    float count = min(history.a + 1.0f, maxCount);
+
+    return vec4(mix(history.rgb, color, 1.0f / count), count);
+}
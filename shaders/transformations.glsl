@@ -3,6 +3,8 @@
  * @brief Implementation of 3D transformation functions
  **************************************************************************************************/
 
+#pragma once
+
 mat2 rotation2D(in float angle) {
     float cosine = cos(angle);
     float sine = sin(angle);
@@ -0,0 +1,26 @@
+/***************************************************************************************************
+ * @file  uniforms.glsl
+ * @brief Declaration of the uniforms shared by the ray-marching shaders
+ **************************************************************************************************/
+
+#pragma once
+
+// Must match the FrameData struct in FrameData.hpp
+layout (std140, binding = 0) uniform FrameData {
+    vec3 cameraPos;
+    float time;
+    vec3 cameraFront;
+    vec3 cameraRight;
+    vec3 cameraUp;
+    vec2 resolution;
+    uint frame;
+
+    vec3 previousCameraPos;
+    vec3 previousCameraFront;
+    vec3 previousCameraRight;
+    vec3 previousCameraUp;
+};
+
+uniform uint active_scene; // Unused by the programs specialized with SCENE
+uniform bool isRelaxed;
+uniform bool isHitAdaptive;
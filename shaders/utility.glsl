@@ -3,6 +3,8 @@
  * @brief Implementation of various utility functions
  **************************************************************************************************/
 
+#pragma once
+
 float smin(in float a, in float b, in float t) {
     float h = clamp(0.5f + 0.5f * (a - b) / t, 0.0f, 1.0f);
     return mix(a, b, h) - t * h * (1.0f - h);
@@ -21,6 +23,13 @@ float max3(in float a, in float b, in float c) {
     return max(a, max(b, c));
 }
 
+// A group of SDFs inside a bounding volume can't be closer than the bound. When the bound is already
+// farther than the closest surface found so far, the group's children don't need to be evaluated:
+// the union would keep the closest surface either way.
+bool isCulled(in float bound, in float closest) {
+    return bound > closest;
+}
+
 vec4 intersectSDF(vec4 a, vec4 b) {
     return a.w > b.w ? a : b;
 }
@@ -5,18 +5,49 @@
 
 #include "Application.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
-
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <utility>
+
+#include "Benchmark.hpp"
+#include "CPURenderer.hpp"
+#include "FrameData.hpp"
 #include "callbacks.hpp"
+#include "image.hpp"
 #include "maths/geometry.hpp"
 
-Application::Application()
-    : window(nullptr), width(900), height(900),
+Application::Application(const Options& options)
+    : options(options),
+      window(nullptr), width(options.width), height(options.height),
+      renderWidth(options.width), renderHeight(options.height),
       time(0.0f), delta(0.0f),
       cursorVisible(false),
-      shader(nullptr),
-      camera(Point(0.0f, 2.0f, 5.0f)),
-      scene(0), hasLighting(true) {
+      shader(nullptr), prepassShader(nullptr), sceneShaders(SCENE_COUNT, nullptr),
+      shaderCompiler(nullptr), pendingShaders(SHADER_KEY_COUNT, false),
+      renderPassLocations(SHADER_KEY_COUNT, -1), shaderWatcher(nullptr),
+      frameDataBuffer(nullptr), prepass(nullptr), sampleBuffer(nullptr),
+      historyBuffer(nullptr), previousHistory(nullptr), renderTarget(nullptr), frameData{},
+      gpuTimer(nullptr), overlayShader(nullptr), overlayLocations{},
+      isOverlayVisible(false), frame(0),
+      gpuFrameTimes(OVERLAY_FRAME_COUNT, 0.0f), latestGPUFrameTime(0),
+      titleUpdateTime(0.0f), gpuTimeSum(0.0f), gpuTimeCount(0),
+      dynamicResolution(options.targetFrameTime),
+      hasDynamicResolution(options.dynamicResolution && !options.benchmark), renderScale(1.0f),
+      frameScales(OVERLAY_FRAME_COUNT, 1.0f),
+      camera(options.cameraPos, options.cameraTarget),
+      scene(options.scene), hasLighting(options.hasLighting), isRelaxed(options.isRelaxed),
+      isHitAdaptive(options.isHitAdaptive), hasPrepass(options.hasPrepass),
+      normalMethod(options.normalMethod), antiAliasing(options.antiAliasing),
+      debugView(DebugView::none), stepHistogram(nullptr) {
+
+    if(options.headless) {
+        return;
+    }
 
     /**** GLFW ****/
     if(!glfwInit()) {
@@ -53,17 +84,84 @@ Application::Application()
     glViewport(0, 0, width, height);
 
     /**** Shader ****/
+    frameDataBuffer = new UniformBuffer(FRAME_DATA_BINDING, sizeof(FrameData));
+    prepass = new ConePrepass(width, height);
+    sampleBuffer = new SampleBuffer(width, height);
+    historyBuffer = new SampleBuffer(width, height);
+    previousHistory = new SampleBuffer(width, height);
+    renderTarget = new SampleBuffer(width, height);
+    stepHistogram = new StepHistogram();
     initShader();
+
+    // The benchmark compiles the specialized programs itself so it never measures the default one
+    if(!options.benchmark) {
+        shaderCompiler = new ShaderCompiler(window);
+        shaderWatcher = new ShaderWatcher("shaders");
+
+        std::vector<bool> isRequested(SHADER_KEY_COUNT, true);
+        isRequested[DEFAULT_SHADER_KEY] = false;
+        isRequested[PREPASS_SHADER_KEY] = false;
+        requestShaders(isRequested);
+    }
+
+    /**** Profiling ****/
+    gpuTimer = new GPUTimer();
+    overlayShader = new Shader("shaders/default.vert", "shaders/overlay.frag");
+    overlayLocations.origin = overlayShader->getUniformLocation("origin");
+    overlayLocations.size = overlayShader->getUniformLocation("size");
+    overlayLocations.maxTime = overlayShader->getUniformLocation("maxTime");
+    overlayLocations.frameTimes = overlayShader->getUniformLocation("frameTimes");
+    overlayLocations.latest = overlayShader->getUniformLocation("latest");
+
+    if(!options.gpuLog.empty()) {
+        gpuLog.open(options.gpuLog);
+        if(!gpuLog.is_open()) {
+            throw std::runtime_error("Couldn't open \"" + options.gpuLog + "\".");
+        }
+
+        gpuLog << "frame,gpu_ms,scale\n";
+    }
 }
 
 Application::~Application() {
+    delete shaderWatcher;
+    delete shaderCompiler;
+
     delete shader;
+    delete prepassShader;
+    for(Shader* sceneShader: sceneShaders) {
+        delete sceneShader;
+    }
 
-    glfwDestroyWindow(window);
-    glfwTerminate();
+    delete overlayShader;
+    delete frameDataBuffer;
+    delete prepass;
+    delete sampleBuffer;
+    delete historyBuffer;
+    delete previousHistory;
+    delete renderTarget;
+    delete stepHistogram;
+    delete gpuTimer;
+
+    if(window) {
+        glfwDestroyWindow(window);
+        glfwTerminate();
+    }
 }
 
 void Application::run() {
+    if(options.headless) {
+        if(options.compareSteps) {
+            compareSteps();
+        } else if(options.benchmark) {
+            runBenchmark();
+        } else {
+            renderOffline();
+        }
+
+        return;
+    }
+
     float vertices[] {
       -1.0f, 1.0f,
       -1.0f, -1.0f,
@@ -91,23 +189,37 @@ void Application::run() {
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
 
-    /**** Main Loop ****/
-    while(!glfwWindowShouldClose(window)) {
-        handleEvents();
+    if(options.benchmark) {
+        runBenchmark();
+    } else {
+        /**** Main Loop ****/
+        while(!glfwWindowShouldClose(window)) {
+            handleEvents();
+            watchShaders();
+            collectShaders();
 
-        delta = glfwGetTime() - time;
-        time = glfwGetTime();
+            delta = glfwGetTime() - time;
+            time = glfwGetTime();
 
-        shader->use();
-        shader->setUniform("time", time);
-        shader->setUniform("cameraPos", camera.getPosition());
-        shader->setUniform("cameraFront", camera.getDirection());
-        shader->setUniform("cameraRight", camera.getRight());
-        shader->setUniform("cameraUp", camera.getUp());
+            updateRenderSize();
+            setFrameUniforms();
 
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+            if(debugView != DebugView::none) {
+                stepHistogram->clear();
+            }
+
+            gpuTimer->begin(frame);
+            drawScene();
+            gpuTimer->end();
+
+            readGPUTimings();
+            if(isOverlayVisible) {
+                drawOverlay();
+            }
 
-        glfwSwapBuffers(window);
+            glfwSwapBuffers(window);
+            ++frame;
+        }
     }
 
     glDeleteVertexArrays(1, &VAO);
@@ -119,7 +231,7 @@ void Application::setWindowSize(int width, int height) {
     this->width = width;
     this->height = height;
 
-    shader->setUniform("resolution", width, height);
+    updateRenderSize();
 }
 
 void Application::handleKeyCallback(int key, int action, int /* mods */) {
@@ -151,25 +263,26 @@ void Application::handleKeyboardEvents() {
                 case GLFW_KEY_ESCAPE:
                     glfwSetWindowShouldClose(window, true);
                     break;
-                case GLFW_KEY_R: {
-                    Shader* temp = shader;
-
-                    try {
-                        initShader();
-                        delete temp;
-                    } catch(const std::exception& exception) {
-                        std::cerr << "ERROR : " << exception.what() << '\n';
-                        shader = temp;
-                    }
+                case GLFW_KEY_R:
+                    requestShaders(std::vector<bool>(SHADER_KEY_COUNT, true));
 
                     keys[key.first] = false;
                     break;
-                }
                 case GLFW_KEY_F5:
                     glfwSetInputMode(window, GLFW_CURSOR,
                                      cursorVisible ? GLFW_CURSOR_DISABLED : GLFW_CURSOR_NORMAL);
                     cursorVisible = !cursorVisible;
 
+                    keys[key.first] = false;
+                    break;
+                case GLFW_KEY_F3:
+                    isOverlayVisible = !isOverlayVisible;
+
+                    keys[key.first] = false;
+                    break;
+                case GLFW_KEY_T:
+                    hasDynamicResolution = !hasDynamicResolution;
+
                     keys[key.first] = false;
                     break;
                 case GLFW_KEY_W:
@@ -191,20 +304,73 @@ void Application::handleKeyboardEvents() {
                     camera.move(CameraControls::downward, delta);
                     break;
                 case GLFW_KEY_UP:
-                    shader->setUniform("active_scene", ++scene);
+                    if(scene + 1 < SCENE_COUNT) {
+                        ++scene;
+                        setAllShaderUniforms();
+                    }
 
                     keys[key.first] = false;
                     break;
                 case GLFW_KEY_DOWN:
                     if(scene > 0) {
-                        shader->setUniform("active_scene", --scene);
+                        --scene;
+                        setAllShaderUniforms();
                     }
 
                     keys[key.first] = false;
                     break;
                 case GLFW_KEY_L:
                     hasLighting = !hasLighting;
-                    shader->setUniform("hasLighting", hasLighting);
+                    setAllShaderUniforms();
+
+                    keys[key.first] = false;
+                    break;
+                case GLFW_KEY_O:
+                    isRelaxed = !isRelaxed;
+                    setAllShaderUniforms();
+
+                    keys[key.first] = false;
+                    break;
+                case GLFW_KEY_K:
+                    isHitAdaptive = !isHitAdaptive;
+                    setAllShaderUniforms();
+
+                    keys[key.first] = false;
+                    break;
+                case GLFW_KEY_P:
+                    hasPrepass = !hasPrepass;
+                    setAllShaderUniforms();
+
+                    keys[key.first] = false;
+                    break;
+                case GLFW_KEY_N:
+                    normalMethod = normalMethod == NormalMethod::central
+                                   ? NormalMethod::tetrahedral
+                                   : NormalMethod::central;
+                    setAllShaderUniforms();
+
+                    keys[key.first] = false;
+                    break;
+                case GLFW_KEY_Q:
+                    antiAliasing = static_cast<AntiAliasing>(
+                        (static_cast<unsigned int>(antiAliasing) + 1) % ANTI_ALIASING_COUNT
+                    );
+                    setAllShaderUniforms();
+
+                    keys[key.first] = false;
+                    break;
+                case GLFW_KEY_H:
+                    debugView = static_cast<DebugView>(
+                        (static_cast<unsigned int>(debugView) + 1) % DEBUG_VIEW_COUNT
+                    );
+                    setAllShaderUniforms();
+
+                    keys[key.first] = false;
+                    break;
+                case GLFW_KEY_J:
+                    if(debugView != DebugView::none) {
+                        printStepHistogram();
+                    }
 
                     keys[key.first] = false;
                     break;
@@ -217,10 +383,484 @@ void Application::handleKeyboardEvents() {
 
 void Application::initShader() {
     shader = new Shader("shaders/default.vert", "shaders/default.frag");
-    shader->use();
-    shader->setUniform("resolution", width, height);
-    shader->setUniform("mouse", 0.5f, 0.5f);
-    shader->setUniform("time", 0.0f);
-    shader->setUniform("active_scene", scene);
-    shader->setUniform("hasLighting", hasLighting);
+    setShaderUniforms(DEFAULT_SHADER_KEY);
+
+    prepassShader = new Shader("shaders/default.vert", "shaders/prepass.frag");
+    setShaderUniforms(PREPASS_SHADER_KEY);
+}
+
+Shader*& Application::getShader(unsigned int key) {
+    if(key == DEFAULT_SHADER_KEY) {
+        return shader;
+    } else if(key == PREPASS_SHADER_KEY) {
+        return prepassShader;
+    }
+
+    return sceneShaders[key];
+}
+
+void Application::setShaderUniforms(unsigned int key) {
+    Shader* program = getShader(key);
+    renderPassLocations[key] = program->getUniformLocation("renderPass");
+
+    program->use();
+    program->setUniform("active_scene", scene);
+    program->setUniform("hasLighting", hasLighting);
+    program->setUniform("isRelaxed", isRelaxed);
+    program->setUniform("isHitAdaptive", isHitAdaptive);
+    program->setUniform("hasPrepass", hasPrepass);
+    program->setUniform("normalMethod", static_cast<unsigned int>(normalMethod));
+    program->setUniform("debugView", static_cast<unsigned int>(debugView));
+    program->setUniform("antiAliasing", static_cast<unsigned int>(getAntiAliasing()));
+    program->setUniform("prepassDepth", 0);
+    program->setUniform("sampleColors", 1);
+    program->setUniform("sampleGeometry", 2);
+    program->setUniform("historyColors", 3);
+    program->setUniform("historyGeometry", 4);
+}
+
+void Application::setAllShaderUniforms() {
+    for(unsigned int key = 0 ; key < SHADER_KEY_COUNT ; ++key) {
+        if(getShader(key)) {
+            setShaderUniforms(key);
+        }
+    }
+
+    clearHistory();
+}
+
+void Application::requestShaders(const std::vector<bool>& isRequested) {
+    shaderCompiler->clear();
+    pendingShaders.assign(SHADER_KEY_COUNT, false);
+
+    // The current scene first since it's the one on screen, then the shaders drawn along with it
+    // until the others are ready
+    std::vector<unsigned int> order{scene, DEFAULT_SHADER_KEY, PREPASS_SHADER_KEY};
+    for(unsigned int i = 1 ; i < SCENE_COUNT ; ++i) {
+        order.push_back((scene + i) % SCENE_COUNT);
+    }
+
+    for(unsigned int key: order) {
+        if(!isRequested[key]) {
+            continue;
+        }
+
+        if(key == PREPASS_SHADER_KEY) {
+            shaderCompiler->request({key, "shaders/default.vert", "shaders/prepass.frag", {}});
+        } else if(key == DEFAULT_SHADER_KEY) {
+            shaderCompiler->request({key, "shaders/default.vert", "shaders/default.frag", {}});
+        } else {
+            shaderCompiler->request({key, "shaders/default.vert", "shaders/default.frag",
+                                     {"SCENE " + std::to_string(key)}});
+        }
+
+        pendingShaders[key] = true;
+    }
+}
+
+void Application::collectShaders() {
+    CompiledShader result;
+
+    while(shaderCompiler->getResult(result)) {
+        pendingShaders[result.key] = false;
+
+        if(!result.shader) {
+            std::cerr << "ERROR : " << result.error << '\n';
+            continue;
+        }
+
+        Shader*& program = getShader(result.key);
+        delete program;
+        program = result.shader;
+
+        setShaderUniforms(result.key);
+
+        // The history was drawn by the previous version of the program
+        if(program == getSceneShader()) {
+            clearHistory();
+        }
+    }
+}
+
+void Application::watchShaders() {
+    const std::vector<std::filesystem::path> modifiedFiles = shaderWatcher->getModifiedFiles();
+    if(modifiedFiles.empty()) {
+        return;
+    }
+
+    std::vector<bool> isRequested = pendingShaders;
+    bool isAnyRequested = false;
+
+    for(unsigned int key = 0 ; key < SHADER_KEY_COUNT ; ++key) {
+        const Shader* program = getShader(key);
+
+        // A program that failed to compile the first time is tried again on every modification
+        for(const std::filesystem::path& file: modifiedFiles) {
+            if(!program || program->isMadeOf(file)) {
+                isRequested[key] = true;
+            }
+        }
+
+        isAnyRequested = isAnyRequested || isRequested[key];
+    }
+
+    if(isAnyRequested) {
+        requestShaders(isRequested);
+    }
+}
+
+Shader* Application::getSceneShader() const {
+    return sceneShaders[scene] ? sceneShaders[scene] : shader;
+}
+
+unsigned int Application::getSceneShaderKey() const {
+    return sceneShaders[scene] ? scene : DEFAULT_SHADER_KEY;
+}
+
+AntiAliasing Application::getAntiAliasing() const {
+    if(antiAliasing == AntiAliasing::temporal && scene < SCENE_COUNT && IS_ANIMATED[scene]) {
+        return AntiAliasing::adaptive;
+    }
+
+    return antiAliasing;
+}
+
+void Application::clearHistory() {
+    if(historyBuffer) {
+        historyBuffer->clear();
+        previousHistory->clear();
+    }
+}
+
+void Application::updateRenderSize() {
+    renderScale = hasDynamicResolution ? dynamicResolution.getScale() : 1.0f;
+    frameScales[frame % OVERLAY_FRAME_COUNT] = renderScale;
+
+    renderWidth = std::max(1u, static_cast<unsigned int>(roundf(renderScale * width)));
+    renderHeight = std::max(1u, static_cast<unsigned int>(roundf(renderScale * height)));
+
+    // Nothing is reallocated while the size stays the same, which the steps of the scale ensure
+    if(prepass) {
+        prepass->resize(renderWidth, renderHeight);
+        sampleBuffer->resize(renderWidth, renderHeight);
+        historyBuffer->resize(renderWidth, renderHeight);
+        previousHistory->resize(renderWidth, renderHeight);
+        renderTarget->resize(renderWidth, renderHeight);
+    }
+}
+
+void Application::setFrameUniforms() {
+    FrameData data{};
+    data.cameraPos = camera.getPosition();
+    data.time = time;
+    data.cameraFront = camera.getDirection();
+    data.cameraRight = camera.getRight();
+    data.cameraUp = camera.getUp();
+    data.resolution = vec2(renderWidth, renderHeight);
+    data.frame = frame;
+
+    data.previousCameraPos = frameData.cameraPos;
+    data.previousCameraFront = frameData.cameraFront;
+    data.previousCameraRight = frameData.cameraRight;
+    data.previousCameraUp = frameData.cameraUp;
+
+    frameDataBuffer->write(&data);
+    frameData = data;
+    getSceneShader()->use();
+}
+
+void Application::drawScene() {
+    int framebufferWidth, framebufferHeight;
+    glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+
+    if(hasPrepass) {
+        prepass->bindFramebuffer();
+        prepassShader->use();
+        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+
+        prepass->bindTexture(0);
+    }
+
+    Shader* sceneShader = getSceneShader();
+    sceneShader->use();
+
+    // Debug views count the steps of a single pass
+    const AntiAliasing mode = debugView == DebugView::none ? getAntiAliasing() : AntiAliasing::none;
+
+    if(mode == AntiAliasing::temporal) {
+        previousHistory->bindTextures(3, 4);
+        historyBuffer->bindFramebuffer();
+        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+
+        historyBuffer->blitColors(framebufferWidth, framebufferHeight);
+        glViewport(0, 0, framebufferWidth, framebufferHeight);
+        std::swap(historyBuffer, previousHistory);
+        return;
+    }
+
+    if(mode == AntiAliasing::adaptive) {
+        const int renderPassLocation = renderPassLocations[getSceneShaderKey()];
+
+        sampleBuffer->bindFramebuffer();
+        sceneShader->setUniform(renderPassLocation, static_cast<unsigned int>(RenderPass::samples));
+        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+
+        sampleBuffer->bindTextures(1, 2);
+        sceneShader->setUniform(renderPassLocation, static_cast<unsigned int>(RenderPass::resolve));
+    }
+
+    if(hasDynamicResolution) {
+        renderTarget->bindFramebuffer();
+        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+
+        renderTarget->blitColors(framebufferWidth, framebufferHeight);
+        glViewport(0, 0, framebufferWidth, framebufferHeight);
+        return;
+    }
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glViewport(0, 0, framebufferWidth, framebufferHeight);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+}
+
+void Application::printStepHistogram() {
+    writeStepHistogram(std::cout, scene, stepHistogram->read());
+    std::cout << '\n';
+}
+
+void Application::readGPUTimings() {
+    GPUTiming timing;
+
+    while(gpuTimer->getResult(timing)) {
+        latestGPUFrameTime = (latestGPUFrameTime + 1) % OVERLAY_FRAME_COUNT;
+        gpuFrameTimes[latestGPUFrameTime] = timing.time;
+
+        gpuTimeSum += timing.time;
+        ++gpuTimeCount;
+
+        // The timings arrive a few frames late, possibly after the scale changed
+        const float scale = frameScales[timing.frame % OVERLAY_FRAME_COUNT];
+        dynamicResolution.addFrameTime(timing.time, scale);
+
+        if(gpuLog.is_open()) {
+            gpuLog << timing.frame << ',' << timing.time << ',' << scale << '\n';
+        }
+    }
+
+    if(time - titleUpdateTime >= 0.5f && gpuTimeCount > 0) {
+        const float average = gpuTimeSum / gpuTimeCount;
+
+        std::ostringstream title;
+        title << std::fixed << std::setprecision(2)
+              << "Ray-Marching - map" << scene + 1 << " - GPU: " << average << "ms";
+
+        if(hasDynamicResolution) {
+            title << " - Scale: " << renderScale;
+        }
+
+        glfwSetWindowTitle(window, title.str().c_str());
+
+        titleUpdateTime = time;
+        gpuTimeSum = 0.0f;
+        gpuTimeCount = 0;
+    }
+}
+
+void Application::drawOverlay() {
+    constexpr int MARGIN = 10;
+    constexpr int GRAPH_WIDTH = 2 * OVERLAY_FRAME_COUNT;
+    constexpr int GRAPH_HEIGHT = 100;
+
+    // The scale adapts to the slowest frame but always shows the 60 and 30 fps lines
+    float maxTime = 1000.0f / 30.0f;
+    for(float frameTime: gpuFrameTimes) {
+        maxTime = fmaxf(maxTime, frameTime);
+    }
+
+    overlayShader->use();
+    overlayShader->setUniform(overlayLocations.origin, MARGIN, MARGIN);
+    overlayShader->setUniform(overlayLocations.size, GRAPH_WIDTH, GRAPH_HEIGHT);
+    overlayShader->setUniform(overlayLocations.maxTime, 1.1f * maxTime);
+    overlayShader->setUniform(overlayLocations.frameTimes, gpuFrameTimes);
+    overlayShader->setUniform(overlayLocations.latest, latestGPUFrameTime);
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glViewport(MARGIN, MARGIN, GRAPH_WIDTH, GRAPH_HEIGHT);
+
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr);
+
+    int framebufferWidth, framebufferHeight;
+    glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+    glViewport(0, 0, framebufferWidth, framebufferHeight);
+    glDisable(GL_BLEND);
+}
+
+Uniforms Application::getUniforms() const {
+    Uniforms uniforms;
+    uniforms.resolution = vec2(width, height);
+    uniforms.time = time;
+    uniforms.cameraPos = camera.getPosition();
+    uniforms.cameraFront = camera.getDirection();
+    uniforms.cameraRight = camera.getRight();
+    uniforms.cameraUp = camera.getUp();
+    uniforms.active_scene = scene;
+    uniforms.hasLighting = hasLighting;
+    uniforms.isRelaxed = isRelaxed;
+    uniforms.isHitAdaptive = isHitAdaptive;
+    uniforms.normalMethod = normalMethod;
+    uniforms.antiAliasing = antiAliasing;
+
+    return uniforms;
+}
+
+void Application::renderOffline() {
+    CPURenderer renderer(width, height, options.threads, options.simd);
+
+    std::cout << "Rendering " << options.frames << " frame(s) of " << width << 'x' << height
+              << " pixels on " << renderer.getThreadCount() << " thread(s) with "
+              << getSIMDLevelName(renderer.getSIMDLevel()) << " packets.\n";
+
+    for(unsigned int frame = 0 ; frame < options.frames ; ++frame) {
+        time = options.time + static_cast<float>(frame) * options.timeStep;
+
+        const auto start = std::chrono::steady_clock::now();
+        renderer.render(getUniforms());
+        const std::chrono::duration<float, std::milli> duration =
+            std::chrono::steady_clock::now() - start;
+
+        const std::filesystem::path path = getFramePath(frame);
+        writeImage(path, width, height, renderer.getPixels());
+
+        std::cout << "Rendered " << path.string() << " in " << duration.count() << "ms\n";
+    }
+}
+
+std::filesystem::path Application::getFramePath(unsigned int frame) const {
+    const std::filesystem::path output(options.output);
+
+    if(options.frames == 1) {
+        return output;
+    }
+
+    std::ostringstream name;
+    name << output.stem().string() << '_' << std::setw(4) << std::setfill('0') << frame
+         << output.extension().string();
+
+    return output.parent_path() / name.str();
+}
+
+void Application::runBenchmark() {
+    const Point start = options.cameraPos;
+    const Point target = options.cameraTarget;
+    const unsigned int frameCount = options.benchmarkFrames;
+
+    BenchmarkReport report;
+    report.width = width;
+    report.height = height;
+
+    std::unique_ptr<CPURenderer> renderer;
+    if(options.headless) {
+        renderer = std::make_unique<CPURenderer>(width, height, options.threads, options.simd);
+        const unsigned int threadCount = renderer->getThreadCount();
+        report.renderer = "CPU (" + std::to_string(threadCount)
+                        + (threadCount == 1 ? " thread, " : " threads, ")
+                        + getSIMDLevelName(renderer->getSIMDLevel()) + ")";
+    } else {
+        glfwSwapInterval(0);
+        report.renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+    }
+
+    for(scene = 0 ; scene < SCENE_COUNT ; ++scene) {
+        if(!options.headless) {
+            if(!sceneShaders[scene]) {
+                sceneShaders[scene] = new Shader("shaders/default.vert", "shaders/default.frag",
+                                                 {"SCENE " + std::to_string(scene)});
+            }
+
+            // The prepass and the default program select the scene at run time, and the history
+            // holds the previous scene
+            setAllShaderUniforms();
+        }
+
+        std::vector<float> frameTimes;
+        frameTimes.reserve(frameCount);
+
+        for(unsigned int frame = 0 ; frame < BENCHMARK_WARMUP_FRAMES + frameCount ; ++frame) {
+            if(!options.headless) {
+                glfwPollEvents();
+
+                if(glfwWindowShouldClose(window) || keys[GLFW_KEY_ESCAPE]) {
+                    throw std::runtime_error("The benchmark was interrupted.");
+                }
+            }
+
+            // Warm-up frames all use the first point of the path
+            const unsigned int pathFrame = frame < BENCHMARK_WARMUP_FRAMES
+                                           ? 0
+                                           : frame - BENCHMARK_WARMUP_FRAMES;
+
+            time = options.time + static_cast<float>(pathFrame) * options.timeStep;
+            camera.setPose(getBenchmarkCameraPosition(start, target, pathFrame, frameCount), target);
+
+            const auto frameStart = std::chrono::steady_clock::now();
+
+            if(options.headless) {
+                renderer->render(getUniforms());
+            } else {
+                setFrameUniforms();
+                drawScene();
+                glFinish();
+            }
+
+            const std::chrono::duration<float, std::milli> duration =
+                std::chrono::steady_clock::now() - frameStart;
+
+            if(!options.headless) {
+                glfwSwapBuffers(window);
+            }
+
+            if(frame >= BENCHMARK_WARMUP_FRAMES) {
+                frameTimes.push_back(duration.count());
+            }
+        }
+
+        report.scenes.push_back(computeFrameStatistics(scene, frameTimes));
+        std::cout << "Benchmarked map" << scene + 1 << '/' << SCENE_COUNT << '\n';
+    }
+
+    std::cout << '\n';
+    writeBenchmarkTable(std::cout, report);
+
+    std::ofstream file(options.benchmarkOutput);
+    if(!file.is_open()) {
+        throw std::runtime_error("Couldn't open \"" + options.benchmarkOutput + "\".");
+    }
+
+    writeBenchmarkJSON(file, report);
+    std::cout << "\nWrote the JSON report to " << options.benchmarkOutput << '\n';
+}
+
+void Application::compareSteps() {
+    CPURenderer renderer(width, height, options.threads, options.simd);
+    std::vector<StepStatistics> scenes;
+
+    for(scene = 0 ; scene < SCENE_COUNT ; ++scene) {
+        Uniforms uniforms = getUniforms();
+
+        StepStatistics statistics;
+        statistics.scene = scene;
+        statistics.relaxation = RELAXATION[scene];
+
+        uniforms.isRelaxed = false;
+        statistics.plainSteps = renderer.measureSteps(uniforms);
+
+        uniforms.isRelaxed = true;
+        statistics.relaxedSteps = renderer.measureSteps(uniforms);
+
+        scenes.push_back(statistics);
+    }
+
+    std::cout << "Mean steps per ray at " << width << 'x' << height << " pixels:\n\n";
+    writeStepTable(std::cout, scenes);
 }
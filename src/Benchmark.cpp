@@ -0,0 +1,246 @@
+/***************************************************************************************************
+ * @file  Benchmark.cpp
+ * @brief Implementation of the frame-time statistics and reports of the benchmark mode
+ **************************************************************************************************/
+
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <numeric>
+#include <stdexcept>
+
+#include "StepHistogram.hpp"
+
+/**
+ * @brief Gets a percentile of sorted values using the nearest-rank method.
+ * @param sorted The values sorted in ascending order.
+ * @param percentile The percentile, between 0 and 100.
+ * @return The smallest value such that at least the given percentage of values are lower or equal.
+ */
+static float getPercentile(const std::vector<float>& sorted, float percentile) {
+    const size_t rank = static_cast<size_t>(ceilf(percentile / 100.0f * sorted.size()));
+    return sorted[std::clamp(rank, size_t(1), sorted.size()) - 1];
+}
+
+FrameStatistics computeFrameStatistics(unsigned int scene, std::vector<float> frameTimes) {
+    if(frameTimes.empty()) {
+        throw std::runtime_error("Can't compute the statistics of an empty series of frames.");
+    }
+
+    std::sort(frameTimes.begin(), frameTimes.end());
+
+    const size_t count = frameTimes.size();
+
+    FrameStatistics statistics;
+    statistics.scene = scene;
+    statistics.frames = count;
+    statistics.min = frameTimes.front();
+    statistics.median = count % 2 == 1
+                        ? frameTimes[count / 2]
+                        : 0.5f * (frameTimes[count / 2 - 1] + frameTimes[count / 2]);
+    statistics.p95 = getPercentile(frameTimes, 95.0f);
+    statistics.p99 = getPercentile(frameTimes, 99.0f);
+    statistics.mean = std::accumulate(frameTimes.begin(), frameTimes.end(), 0.0f) / count;
+    statistics.fps = 1000.0f / statistics.mean;
+
+    return statistics;
+}
+
+Point getBenchmarkCameraPosition(const Point& start, const Point& target,
+                                 unsigned int frame, unsigned int frameCount) {
+    const float angle = 2.0f * M_PIf * static_cast<float>(frame) / static_cast<float>(frameCount);
+    const float cosine = cosf(angle);
+    const float sine = sinf(angle);
+
+    const Vector offset = start - target;
+
+    return target + Vector(cosine * offset.x - sine * offset.z,
+                           offset.y,
+                           sine * offset.x + cosine * offset.z);
+}
+
+void writeBenchmarkTable(std::ostream& stream, const BenchmarkReport& report) {
+    const std::ios::fmtflags flags = stream.flags();
+
+    stream << "Renderer: " << report.renderer << '\n'
+           << "Resolution: " << report.width << 'x' << report.height << "\n\n"
+           << std::left << std::setw(7) << "Scene" << std::right
+           << std::setw(8) << "Frames"
+           << std::setw(11) << "Min (ms)"
+           << std::setw(11) << "Med (ms)"
+           << std::setw(11) << "P95 (ms)"
+           << std::setw(11) << "P99 (ms)"
+           << std::setw(10) << "FPS" << '\n';
+
+    stream << std::fixed << std::setprecision(2);
+    for(const FrameStatistics& scene: report.scenes) {
+        stream << std::left << std::setw(7) << "map" + std::to_string(scene.scene + 1) << std::right
+               << std::setw(8) << scene.frames
+               << std::setw(11) << scene.min
+               << std::setw(11) << scene.median
+               << std::setw(11) << scene.p95
+               << std::setw(11) << scene.p99
+               << std::setw(10) << scene.fps << '\n';
+    }
+
+    stream.flags(flags);
+}
+
+void writeStepTable(std::ostream& stream, const std::vector<StepStatistics>& scenes) {
+    const std::ios::fmtflags flags = stream.flags();
+
+    stream << std::left << std::setw(7) << "Scene" << std::right
+           << std::setw(12) << "Relaxation"
+           << std::setw(13) << "Plain steps"
+           << std::setw(15) << "Relaxed steps"
+           << std::setw(12) << "Reduction" << '\n';
+
+    stream << std::fixed << std::setprecision(2);
+    for(const StepStatistics& scene: scenes) {
+        const float reduction = 100.0f * (1.0f - scene.relaxedSteps / scene.plainSteps);
+
+        stream << std::left << std::setw(7) << "map" + std::to_string(scene.scene + 1) << std::right
+               << std::setw(12) << scene.relaxation
+               << std::setw(13) << scene.plainSteps
+               << std::setw(15) << scene.relaxedSteps
+               << std::setw(11) << reduction << "%\n";
+    }
+
+    stream.flags(flags);
+}
+
+/**
+ * @brief Gets a percentile of the step counts of a pass of the step histogram.
+ * @param bins The bins of the pass.
+ * @param count The number of pixels counted in the bins.
+ * @param percentile The percentile, between 0 and 100.
+ * @return The largest step count of the bin the percentile falls in.
+ */
+static unsigned int getBinPercentile(const unsigned int* bins, unsigned long long count,
+                                     float percentile) {
+    const unsigned long long rank = static_cast<unsigned long long>(ceilf(percentile / 100.0f
+                                                                          * count));
+    unsigned long long sum = 0u;
+    unsigned int bin = 0u;
+
+    for(; bin + 1 < STEP_HISTOGRAM_BIN_COUNT ; ++bin) {
+        sum += bins[bin];
+        if(sum >= std::max(rank, 1ull)) {
+            break;
+        }
+    }
+
+    return (bin + 1) * STEP_HISTOGRAM_BIN_SIZE - 1;
+}
+
+void writeStepHistogram(std::ostream& stream, unsigned int scene,
+                        const std::vector<unsigned int>& bins) {
+    const std::ios::fmtflags flags = stream.flags();
+    const char* passes[STEP_HISTOGRAM_PASS_COUNT] {"march", "shadow", "occlusion"};
+
+    stream << "Steps per pixel in map" << scene + 1 << ":\n\n"
+           << std::left << std::setw(11) << "Pass" << std::right
+           << std::setw(10) << "Pixels"
+           << std::setw(8) << "Mean"
+           << std::setw(6) << "P50"
+           << std::setw(6) << "P90"
+           << std::setw(6) << "P99"
+           << std::setw(6) << "Max" << '\n';
+
+    stream << std::fixed << std::setprecision(2);
+    for(unsigned int pass = 0 ; pass < STEP_HISTOGRAM_PASS_COUNT ; ++pass) {
+        const unsigned int* passBins = bins.data() + pass * STEP_HISTOGRAM_BIN_COUNT;
+
+        unsigned long long count = 0u;
+        float sum = 0.0f;
+        unsigned int max = 0u;
+
+        for(unsigned int bin = 0 ; bin < STEP_HISTOGRAM_BIN_COUNT ; ++bin) {
+            // The mean assumes the step counts are spread evenly over each bin
+            count += passBins[bin];
+            sum += passBins[bin] * (STEP_HISTOGRAM_BIN_SIZE * (bin + 0.5f) - 0.5f);
+
+            if(passBins[bin] > 0) {
+                max = (bin + 1) * STEP_HISTOGRAM_BIN_SIZE - 1;
+            }
+        }
+
+        stream << std::left << std::setw(11) << passes[pass] << std::right
+               << std::setw(10) << count;
+
+        if(count == 0) {
+            stream << std::setw(8) << '-' << std::setw(6) << '-' << std::setw(6) << '-'
+                   << std::setw(6) << '-' << std::setw(6) << '-' << '\n';
+            continue;
+        }
+
+        stream << std::setw(8) << sum / count
+               << std::setw(6) << getBinPercentile(passBins, count, 50.0f)
+               << std::setw(6) << getBinPercentile(passBins, count, 90.0f)
+               << std::setw(6) << getBinPercentile(passBins, count, 99.0f)
+               << std::setw(6) << max << '\n';
+    }
+
+    stream.flags(flags);
+}
+
+/**
+ * @brief Escapes the characters of a string that can't appear as is in a JSON string.
+ * @param string The string.
+ * @return The escaped string.
+ */
+static std::string escapeJSON(const std::string& string) {
+    std::string result;
+
+    for(char character: string) {
+        switch(character) {
+            case '"':
+                result += "\\\"";
+                break;
+            case '\\':
+                result += "\\\\";
+                break;
+            case '\n':
+                result += "\\n";
+                break;
+            default:
+                if(static_cast<unsigned char>(character) >= 0x20) {
+                    result += character;
+                }
+                break;
+        }
+    }
+
+    return result;
+}
+
+void writeBenchmarkJSON(std::ostream& stream, const BenchmarkReport& report) {
+    const std::ios::fmtflags flags = stream.flags();
+
+    stream << "{\n"
+           << "  \"renderer\": \"" << escapeJSON(report.renderer) << "\",\n"
+           << "  \"width\": " << report.width << ",\n"
+           << "  \"height\": " << report.height << ",\n"
+           << "  \"scenes\": [";
+
+    stream << std::fixed << std::setprecision(4);
+    for(size_t i = 0 ; i < report.scenes.size() ; ++i) {
+        const FrameStatistics& scene = report.scenes[i];
+
+        stream << (i == 0 ? "\n" : ",\n")
+               << "    {\"scene\": \"map" << scene.scene + 1 << "\""
+               << ", \"frames\": " << scene.frames
+               << ", \"min_ms\": " << scene.min
+               << ", \"median_ms\": " << scene.median
+               << ", \"p95_ms\": " << scene.p95
+               << ", \"p99_ms\": " << scene.p99
+               << ", \"mean_ms\": " << scene.mean
+               << ", \"fps\": " << scene.fps << '}';
+    }
+
+    stream << "\n  ]\n}\n";
+
+    stream.flags(flags);
+}
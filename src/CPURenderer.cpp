@@ -0,0 +1,247 @@
+/***************************************************************************************************
+ * @file  CPURenderer.cpp
+ * @brief Implementation of the CPURenderer class
+ **************************************************************************************************/
+
+#include "CPURenderer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "cpu/render.hpp"
+#include "maths/geometry.hpp"
+
+CPURenderer::CPURenderer(unsigned int width, unsigned int height, unsigned int threadCount,
+                         SIMDLevel simdLevel)
+    : width(width), height(height), threadCount(threadCount), simdLevel(simdLevel),
+      tilesX((width + TILE_SIZE - 1u) / TILE_SIZE), tilesY((height + TILE_SIZE - 1u) / TILE_SIZE),
+      pixels(width * height) {
+
+    if(this->threadCount == 0u) {
+        this->threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+}
+
+void CPURenderer::render(const Uniforms& uniforms) {
+    Uniforms frame = uniforms;
+    frame.resolution = vec2(width, height);
+
+    // Frames are rendered independently so there is no history to accumulate samples in
+    if(frame.antiAliasing == AntiAliasing::temporal) {
+        frame.antiAliasing = AntiAliasing::adaptive;
+    }
+
+    if(frame.antiAliasing != AntiAliasing::adaptive) {
+        forEachTile([&](unsigned int tile) { renderTile(tile, frame); });
+        return;
+    }
+
+    // Edges are found from the neighbors of each sample, which may belong to another tile
+    samples.resize(width * height);
+    geometry.resize(width * height);
+
+    forEachTile([&](unsigned int tile) { sampleTile(tile, frame); });
+    forEachTile([&](unsigned int tile) { resolveTile(tile, frame); });
+}
+
+float CPURenderer::measureSteps(const Uniforms& uniforms) {
+    Uniforms frame = uniforms;
+    frame.resolution = vec2(width, height);
+
+    std::atomic<unsigned long long> totalSteps(0u);
+
+    forEachTile([&](unsigned int tile) {
+        const unsigned int startX = (tile % tilesX) * TILE_SIZE;
+        const unsigned int startY = (tile / tilesX) * TILE_SIZE;
+        const unsigned int endX = std::min(startX + TILE_SIZE, width);
+        const unsigned int endY = std::min(startY + TILE_SIZE, height);
+
+        unsigned long long tileSteps = 0u;
+
+        std::vector<Ray> rays(endX - startX);
+        std::vector<float> distances(rays.size());
+        std::vector<Color> colors(rays.size());
+        std::vector<unsigned int> steps(rays.size());
+
+        for(unsigned int y = startY ; y < endY ; ++y) {
+            for(unsigned int x = startX ; x < endX ; ++x) {
+                const vec2 fragCoord(static_cast<float>(x) + 0.5f, static_cast<float>(y) + 0.5f);
+                rays[x - startX] = getRay(fragCoord, vec2(0.0f), frame);
+            }
+
+            raymarchPacket(rays.data(), rays.size(), frame, simdLevel,
+                           distances.data(), colors.data(), steps.data());
+
+            for(unsigned int raySteps: steps) {
+                tileSteps += raySteps;
+            }
+        }
+
+        totalSteps += tileSteps;
+    });
+
+    return static_cast<float>(totalSteps) / static_cast<float>(width * height);
+}
+
+unsigned int CPURenderer::getWidth() const {
+    return width;
+}
+
+unsigned int CPURenderer::getHeight() const {
+    return height;
+}
+
+unsigned int CPURenderer::getThreadCount() const {
+    return threadCount;
+}
+
+SIMDLevel CPURenderer::getSIMDLevel() const {
+    return simdLevel;
+}
+
+const std::vector<Color>& CPURenderer::getPixels() const {
+    return pixels;
+}
+
+void CPURenderer::forEachTile(const std::function<void(unsigned int)>& task) {
+    const unsigned int tileCount = tilesX * tilesY;
+    std::atomic<unsigned int> nextTile(0u);
+
+    auto work = [&]() {
+        for(unsigned int tile = nextTile++ ; tile < tileCount ; tile = nextTile++) {
+            task(tile);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadCount - 1u);
+    for(unsigned int i = 1u ; i < threadCount ; ++i) {
+        workers.emplace_back(work);
+    }
+
+    work();
+
+    for(std::thread& worker: workers) {
+        worker.join();
+    }
+}
+
+void CPURenderer::renderPixels(const std::vector<unsigned int>& indices, unsigned int sampleCount,
+                               const Uniforms& uniforms, Color* colors, vec4* geometry) const {
+    std::vector<Ray> rays;
+    rays.reserve(indices.size() * sampleCount);
+
+    for(unsigned int index: indices) {
+        // Rows are stored from the top but gl_FragCoord starts at the bottom
+        const vec2 fragCoord(static_cast<float>(index % width) + 0.5f,
+                             static_cast<float>(height - 1u - index / width) + 0.5f);
+
+        for(unsigned int sample = 0u ; sample < sampleCount ; ++sample) {
+            rays.push_back(getRay(fragCoord,
+                                  sampleCount == 1u ? vec2(0.0f) : getAntiAliasingOffset(sample),
+                                  uniforms));
+        }
+    }
+
+    std::vector<Color> sampleColors(rays.size());
+    std::vector<vec4> sampleGeometry(rays.size());
+    renderRays(rays.data(), rays.size(), uniforms, simdLevel,
+               sampleColors.data(), sampleGeometry.data());
+
+    for(unsigned int i = 0u ; i < indices.size() ; ++i) {
+        if(sampleCount == 1u) {
+            colors[indices[i]] = sampleColors[i];
+
+            if(geometry) {
+                geometry[indices[i]] = sampleGeometry[i];
+            }
+
+            continue;
+        }
+
+        // Summed in the same order as renderAntiAliasing4
+        Color sum = sampleColors[i * sampleCount];
+        for(unsigned int sample = 1u ; sample < sampleCount ; ++sample) {
+            sum += sampleColors[i * sampleCount + sample];
+        }
+
+        colors[indices[i]] = (1.0f / static_cast<float>(sampleCount)) * sum;
+    }
+}
+
+void CPURenderer::renderTile(unsigned int tile, const Uniforms& uniforms) {
+    const unsigned int startX = (tile % tilesX) * TILE_SIZE;
+    const unsigned int startY = (tile / tilesX) * TILE_SIZE;
+    const unsigned int endX = std::min(startX + TILE_SIZE, width);
+    const unsigned int endY = std::min(startY + TILE_SIZE, height);
+
+    const unsigned int sampleCount = uniforms.antiAliasing == AntiAliasing::full
+                                     ? ANTI_ALIASING_SAMPLE_COUNT
+                                     : 1u;
+    std::vector<unsigned int> indices(endX - startX);
+
+    for(unsigned int y = startY ; y < endY ; ++y) {
+        for(unsigned int x = startX ; x < endX ; ++x) {
+            indices[x - startX] = y * width + x;
+        }
+
+        renderPixels(indices, sampleCount, uniforms, pixels.data(), nullptr);
+    }
+}
+
+void CPURenderer::sampleTile(unsigned int tile, const Uniforms& uniforms) {
+    const unsigned int startX = (tile % tilesX) * TILE_SIZE;
+    const unsigned int startY = (tile / tilesX) * TILE_SIZE;
+    const unsigned int endX = std::min(startX + TILE_SIZE, width);
+    const unsigned int endY = std::min(startY + TILE_SIZE, height);
+
+    std::vector<unsigned int> indices(endX - startX);
+
+    for(unsigned int y = startY ; y < endY ; ++y) {
+        for(unsigned int x = startX ; x < endX ; ++x) {
+            indices[x - startX] = y * width + x;
+        }
+
+        renderPixels(indices, 1u, uniforms, samples.data(), geometry.data());
+    }
+}
+
+void CPURenderer::resolveTile(unsigned int tile, const Uniforms& uniforms) {
+    const unsigned int startX = (tile % tilesX) * TILE_SIZE;
+    const unsigned int startY = (tile / tilesX) * TILE_SIZE;
+    const unsigned int endX = std::min(startX + TILE_SIZE, width);
+    const unsigned int endY = std::min(startY + TILE_SIZE, height);
+
+    std::vector<unsigned int> edges;
+    edges.reserve(endX - startX);
+
+    for(unsigned int y = startY ; y < endY ; ++y) {
+        const unsigned int top = y > 0u ? y - 1u : y;
+        const unsigned int bottom = y + 1u < height ? y + 1u : y;
+
+        edges.clear();
+
+        for(unsigned int x = startX ; x < endX ; ++x) {
+            const unsigned int index = y * width + x;
+            const unsigned int left = y * width + (x > 0u ? x - 1u : x);
+            const unsigned int right = y * width + (x + 1u < width ? x + 1u : x);
+
+            const bool isOnEdge =
+                isEdge(samples[index], geometry[index],
+                       samples[left], geometry[left], samples[right], geometry[right])
+                || isEdge(samples[index], geometry[index],
+                          samples[top * width + x], geometry[top * width + x],
+                          samples[bottom * width + x], geometry[bottom * width + x]);
+
+            if(isOnEdge) {
+                edges.push_back(index);
+            } else {
+                pixels[index] = samples[index];
+            }
+        }
+
+        // The edges of the row are supersampled together so their rays fill the packets
+        renderPixels(edges, ANTI_ALIASING_SAMPLE_COUNT, uniforms, pixels.data(), nullptr);
+    }
+}
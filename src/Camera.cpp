@@ -10,14 +10,13 @@
 #include "maths/trigonometry.hpp"
 
 Camera::Camera(const Point& position)
+    : Camera(position, Point(0.0f, 0.0f, 0.0f)) { }
+
+Camera::Camera(const Point& position, const Point& target)
     : position(position),
       worldUp(0.0f, 1.0f, 0.0f) {
 
-    const Vector direction = -1.0f * normalize(position);
-    pitch = asinf(direction.y);
-    yaw = asinf(direction.z / cosf(pitch));
-
-    look(vec2());
+    setPose(position, target);
 }
 
 Point Camera::getPosition() const {
@@ -36,6 +35,16 @@ Point Camera::getUp() const {
     return up;
 }
 
+void Camera::setPose(const Point& position, const Point& target) {
+    this->position = position;
+
+    const Vector direction = normalize(target - position);
+    pitch = asinf(direction.y);
+    yaw = atan2f(direction.z, direction.x);
+
+    look(vec2());
+}
+
 void Camera::move(CameraControls direction, float deltaTime) {
     const float speed = 5.0f * deltaTime;
 
@@ -0,0 +1,73 @@
+/***************************************************************************************************
+ * @file  ConePrepass.cpp
+ * @brief Implementation of the ConePrepass class
+ **************************************************************************************************/
+
+#include "ConePrepass.hpp"
+
+#include <glad/glad.h>
+#include <stdexcept>
+
+/**
+ * @brief Calculates the number of tiles needed to cover pixels.
+ * @param pixels The number of pixels.
+ * @return The number of tiles, rounded up so the last pixels are covered too.
+ */
+static unsigned int getTileCount(unsigned int pixels) {
+    return (pixels + PREPASS_TILE_SIZE - 1) / PREPASS_TILE_SIZE;
+}
+
+ConePrepass::ConePrepass(unsigned int width, unsigned int height)
+    : framebuffer(0), texture(0), width(getTileCount(width)), height(getTileCount(height)) {
+
+    glGenFramebuffers(1, &framebuffer);
+    allocate();
+}
+
+ConePrepass::~ConePrepass() {
+    glDeleteTextures(1, &texture);
+    glDeleteFramebuffers(1, &framebuffer);
+}
+
+void ConePrepass::resize(unsigned int width, unsigned int height) {
+    if(getTileCount(width) == this->width && getTileCount(height) == this->height) {
+        return;
+    }
+
+    this->width = getTileCount(width);
+    this->height = getTileCount(height);
+    allocate();
+}
+
+void ConePrepass::bindFramebuffer() const {
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glViewport(0, 0, width, height);
+}
+
+void ConePrepass::bindTexture(unsigned int unit) const {
+    glActiveTexture(GL_TEXTURE0 + unit);
+    glBindTexture(GL_TEXTURE_2D, texture);
+}
+
+void ConePrepass::allocate() {
+    // Immutable storage can't be resized so the texture is created again
+    glDeleteTextures(1, &texture);
+    glGenTextures(1, &texture);
+
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_R32F, width, height);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+
+    const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    if(status != GL_FRAMEBUFFER_COMPLETE) {
+        throw std::runtime_error("The cone marching prepass' framebuffer is incomplete.");
+    }
+}
@@ -0,0 +1,34 @@
+/***************************************************************************************************
+ * @file  DynamicResolution.cpp
+ * @brief Implementation of the DynamicResolution class
+ **************************************************************************************************/
+
+#include "DynamicResolution.hpp"
+
+#include <cmath>
+#include "maths/common.hpp"
+
+DynamicResolution::DynamicResolution(float targetTime)
+    : targetTime(targetTime), fullScaleTime(0.0f), scale(1.0f) { }
+
+void DynamicResolution::addFrameTime(float time, float scale) {
+    const float fullScale = time / (scale * scale);
+
+    fullScaleTime = fullScaleTime == 0.0f
+                    ? fullScale
+                    : fullScaleTime + DYNAMIC_RESOLUTION_SMOOTHING * (fullScale - fullScaleTime);
+
+    // Rounding down keeps frames under the target and the scale from flickering between two steps
+    const float ideal = sqrtf(targetTime / fullScaleTime);
+    const float stepped = floorf(ideal / DYNAMIC_RESOLUTION_STEP) * DYNAMIC_RESOLUTION_STEP;
+
+    this->scale = clamp(stepped, DYNAMIC_RESOLUTION_MIN_SCALE, 1.0f);
+}
+
+float DynamicResolution::getScale() const {
+    return scale;
+}
+
+float DynamicResolution::getTargetTime() const {
+    return targetTime;
+}
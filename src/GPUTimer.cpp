@@ -0,0 +1,61 @@
+/***************************************************************************************************
+ * @file  GPUTimer.cpp
+ * @brief Implementation of the GPUTimer class
+ **************************************************************************************************/
+
+#include "GPUTimer.hpp"
+
+#include <glad/glad.h>
+
+GPUTimer::GPUTimer() : frames{}, first(0), pending(0), isMeasuring(false) {
+    glGenQueries(GPU_TIMER_QUERY_COUNT, queries);
+}
+
+GPUTimer::~GPUTimer() {
+    glDeleteQueries(GPU_TIMER_QUERY_COUNT, queries);
+}
+
+void GPUTimer::begin(unsigned int frame) {
+    if(isMeasuring || pending == GPU_TIMER_QUERY_COUNT) {
+        return;
+    }
+
+    const unsigned int index = (first + pending) % GPU_TIMER_QUERY_COUNT;
+    frames[index] = frame;
+
+    glBeginQuery(GL_TIME_ELAPSED, queries[index]);
+    isMeasuring = true;
+}
+
+void GPUTimer::end() {
+    if(!isMeasuring) {
+        return;
+    }
+
+    glEndQuery(GL_TIME_ELAPSED);
+    isMeasuring = false;
+    ++pending;
+}
+
+bool GPUTimer::getResult(GPUTiming& timing) {
+    if(pending == 0) {
+        return false;
+    }
+
+    int isAvailable = 0;
+    glGetQueryObjectiv(queries[first], GL_QUERY_RESULT_AVAILABLE, &isAvailable);
+    if(!isAvailable) {
+        return false;
+    }
+
+    GLuint64 elapsed = 0;
+    glGetQueryObjectui64v(queries[first], GL_QUERY_RESULT, &elapsed);
+
+    timing.frame = frames[first];
+    timing.time = static_cast<float>(elapsed) * 1e-6f;
+
+    first = (first + 1) % GPU_TIMER_QUERY_COUNT;
+    --pending;
+
+    return true;
+}
@@ -0,0 +1,288 @@
+/***************************************************************************************************
+ * @file  Options.cpp
+ * @brief Implementation of the Options struct and of the command line parsing
+ **************************************************************************************************/
+
+#include "Options.hpp"
+
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+
+#include "cpu/raymarching.hpp"
+#include "cpu/simd.hpp"
+
+Options::Options()
+    : help(false), headless(false),
+      width(900), height(900),
+      scene(0), hasLighting(true), isRelaxed(true), isHitAdaptive(true),
+      hasPrepass(true),
+      normalMethod(NormalMethod::tetrahedral), antiAliasing(AntiAliasing::adaptive),
+      cameraPos(0.0f, 2.0f, 5.0f), cameraTarget(0.0f, 0.0f, 0.0f),
+      frames(1), time(0.0f), timeStep(1.0f / 60.0f), threads(0),
+      simd(getSupportedSIMDLevel()),
+      output("frame.ppm"),
+      benchmark(false), benchmarkFrames(120), benchmarkOutput("benchmark.json"),
+      compareSteps(false),
+      gpuLog(),
+      dynamicResolution(false), targetFrameTime(1000.0f / 60.0f) { }
+
+/**
+ * @brief Gets the value following an option, throwing if there is none.
+ * @param argc The number of arguments.
+ * @param argv The arguments.
+ * @param index The index of the option. Incremented to point to its value.
+ * @return The value of the option.
+ */
+static std::string nextValue(int argc, char* argv[], int& index) {
+    if(index + 1 >= argc) {
+        throw std::runtime_error("Missing value for option \"" + std::string(argv[index]) + "\".");
+    }
+
+    return argv[++index];
+}
+
+/**
+ * @brief Reads an unsigned integer from the value of an option.
+ * @param option The name of the option.
+ * @param value The value of the option.
+ * @return The unsigned integer.
+ */
+static unsigned int parseUnsigned(const std::string& option, const std::string& value) {
+    std::istringstream stream(value);
+    long long result;
+
+    if(!(stream >> result) || !stream.eof() || result < 0) {
+        throw std::runtime_error("Invalid value \"" + value + "\" for option \"" + option + "\".");
+    }
+
+    return static_cast<unsigned int>(result);
+}
+
+/**
+ * @brief Reads a float from the value of an option.
+ * @param option The name of the option.
+ * @param value The value of the option.
+ * @return The float.
+ */
+static float parseFloat(const std::string& option, const std::string& value) {
+    std::istringstream stream(value);
+    float result;
+
+    if(!(stream >> result) || !stream.eof()) {
+        throw std::runtime_error("Invalid value \"" + value + "\" for option \"" + option + "\".");
+    }
+
+    return result;
+}
+
+/**
+ * @brief Reads a point written as "x,y,z" from the value of an option.
+ * @param option The name of the option.
+ * @param value The value of the option.
+ * @return The point.
+ */
+static Point parsePoint(const std::string& option, const std::string& value) {
+    std::istringstream stream(value);
+    Point result;
+    char comma1, comma2;
+
+    if(!(stream >> result.x >> comma1 >> result.y >> comma2 >> result.z) || !stream.eof()
+       || comma1 != ',' || comma2 != ',') {
+        throw std::runtime_error("Invalid value \"" + value + "\" for option \"" + option
+                                 + "\", expected \"x,y,z\".");
+    }
+
+    return result;
+}
+
+Options parseOptions(int argc, char* argv[]) {
+    Options options;
+
+    for(int i = 1 ; i < argc ; ++i) {
+        const std::string option = argv[i];
+
+        if(option == "-h" || option == "--help") {
+            options.help = true;
+        } else if(option == "--headless") {
+            options.headless = true;
+        } else if(option == "--width") {
+            options.width = parseUnsigned(option, nextValue(argc, argv, i));
+        } else if(option == "--height") {
+            options.height = parseUnsigned(option, nextValue(argc, argv, i));
+        } else if(option == "--scene") {
+            options.scene = parseUnsigned(option, nextValue(argc, argv, i));
+
+            if(options.scene < 1 || options.scene > SCENE_COUNT) {
+                throw std::runtime_error("The scene must be between 1 and "
+                                         + std::to_string(SCENE_COUNT) + '.');
+            }
+
+            --options.scene;
+        } else if(option == "--no-lighting") {
+            options.hasLighting = false;
+        } else if(option == "--no-relaxation") {
+            options.isRelaxed = false;
+        } else if(option == "--no-adaptive-hit") {
+            options.isHitAdaptive = false;
+        } else if(option == "--no-prepass") {
+            options.hasPrepass = false;
+        } else if(option == "--normals") {
+            const std::string value = nextValue(argc, argv, i);
+
+            if(value == "central") {
+                options.normalMethod = NormalMethod::central;
+            } else if(value == "tetrahedral") {
+                options.normalMethod = NormalMethod::tetrahedral;
+            } else {
+                throw std::runtime_error("Invalid value \"" + value + "\" for option \"" + option
+                                         + "\", expected \"central\" or \"tetrahedral\".");
+            }
+        } else if(option == "--anti-aliasing") {
+            const std::string value = nextValue(argc, argv, i);
+
+            if(value == "none") {
+                options.antiAliasing = AntiAliasing::none;
+            } else if(value == "adaptive") {
+                options.antiAliasing = AntiAliasing::adaptive;
+            } else if(value == "full") {
+                options.antiAliasing = AntiAliasing::full;
+            } else if(value == "temporal") {
+                options.antiAliasing = AntiAliasing::temporal;
+            } else {
+                throw std::runtime_error("Invalid value \"" + value + "\" for option \"" + option
+                                         + "\", expected \"none\", \"adaptive\", \"full\" or "
+                                         + "\"temporal\".");
+            }
+        } else if(option == "--camera") {
+            options.cameraPos = parsePoint(option, nextValue(argc, argv, i));
+        } else if(option == "--target") {
+            options.cameraTarget = parsePoint(option, nextValue(argc, argv, i));
+        } else if(option == "--frames") {
+            options.frames = parseUnsigned(option, nextValue(argc, argv, i));
+        } else if(option == "--time") {
+            options.time = parseFloat(option, nextValue(argc, argv, i));
+        } else if(option == "--time-step") {
+            options.timeStep = parseFloat(option, nextValue(argc, argv, i));
+        } else if(option == "--threads") {
+            options.threads = parseUnsigned(option, nextValue(argc, argv, i));
+        } else if(option == "--simd") {
+            const std::string value = nextValue(argc, argv, i);
+
+            if(!parseSIMDLevel(value, options.simd)) {
+                throw std::runtime_error("Invalid value \"" + value + "\" for option \"" + option
+                                         + "\", expected \"scalar\", \"sse\", \"avx2\" or "
+                                         + "\"avx512\".");
+            }
+
+            if(options.simd > getSupportedSIMDLevel()) {
+                throw std::runtime_error("This CPU doesn't support \"" + value + "\", the widest "
+                                         + "instruction set it supports is \""
+                                         + getSIMDLevelName(getSupportedSIMDLevel()) + "\".");
+            }
+        } else if(option == "--output") {
+            options.output = nextValue(argc, argv, i);
+        } else if(option == "--benchmark") {
+            options.benchmark = true;
+        } else if(option == "--benchmark-frames") {
+            options.benchmarkFrames = parseUnsigned(option, nextValue(argc, argv, i));
+        } else if(option == "--benchmark-output") {
+            options.benchmarkOutput = nextValue(argc, argv, i);
+        } else if(option == "--compare-steps") {
+            options.compareSteps = true;
+            options.headless = true;
+        } else if(option == "--gpu-log") {
+            options.gpuLog = nextValue(argc, argv, i);
+        } else if(option == "--dynamic-resolution") {
+            options.dynamicResolution = true;
+        } else if(option == "--target-frame-time") {
+            options.targetFrameTime = parseFloat(option, nextValue(argc, argv, i));
+        } else {
+            throw std::runtime_error("Unknown option \"" + option + "\".");
+        }
+    }
+
+    if(options.width == 0 || options.height == 0) {
+        throw std::runtime_error("The width and height must be greater than 0.");
+    }
+
+    if(options.benchmarkFrames == 0) {
+        throw std::runtime_error("The benchmark needs at least one frame per scene.");
+    }
+
+    const std::string extension = std::filesystem::path(options.output).extension().string();
+    if(extension != ".ppm" && extension != ".png") {
+        throw std::runtime_error("Unsupported image format \"" + extension
+                                 + "\", expected \".ppm\" or \".png\".");
+    }
+
+    if(options.targetFrameTime <= 0.0f) {
+        throw std::runtime_error("The target frame time must be greater than 0.");
+    }
+
+    if(options.cameraPos == options.cameraTarget) {
+        throw std::runtime_error("The camera can't look at its own position.");
+    }
+
+    return options;
+}
+
+void printUsage(std::ostream& stream, const std::string& program) {
+    stream << "Usage: " << program << " [options]\n"
+           << "\n"
+           << "Options:\n"
+           << "  -h, --help          Shows this message.\n"
+           << "  --width <pixels>    Width of the window or of the images (default: 900).\n"
+           << "  --height <pixels>   Height of the window or of the images (default: 900).\n"
+           << "  --scene <1-" << SCENE_COUNT << ">      "
+           << "Scene to render, mapN in maps.glsl (default: 1).\n"
+           << "  --no-lighting       Disables lighting.\n"
+           << "  --no-relaxation     Disables over-relaxed sphere tracing.\n"
+           << "  --no-adaptive-hit   Marches every scene with the fixed hit distance and maximum\n"
+           << "                      number of steps.\n"
+           << "  --no-prepass        Disables the cone marching prepass.\n"
+           << "  --normals <method>  How normals are estimated: \"central\" differences with 6\n"
+           << "                      samples or \"tetrahedral\" with 4 (default: tetrahedral).\n"
+           << "  --anti-aliasing <mode>\n"
+           << "                      Samples per pixel: \"none\" for 1, \"adaptive\" for 4 on edges\n"
+           << "                      only, \"full\" for 4 everywhere or \"temporal\" for 1 blended\n"
+           << "                      with the previous frames, adaptive on the CPU and in animated\n"
+           << "                      scenes (default: adaptive).\n"
+           << "  --camera <x,y,z>    Position of the camera (default: 0,2,5).\n"
+           << "  --target <x,y,z>    Point the camera looks at (default: 0,0,0).\n"
+           << "\n"
+           << "Headless rendering:\n"
+           << "  --headless          Renders frames on the CPU and writes them to files instead of\n"
+           << "                      opening a window.\n"
+           << "  --frames <count>    Number of frames to render (default: 1).\n"
+           << "  --time <seconds>    Time of the first frame (default: 0).\n"
+           << "  --time-step <sec>   Time between two frames (default: 1/60).\n"
+           << "  --threads <count>   Number of render threads, 0 for all cores (default: 0).\n"
+           << "  --simd <level>      Instruction set rays are marched with: \"scalar\" for 1 ray\n"
+           << "                      at a time, \"sse\" for 4, \"avx2\" for 8 or \"avx512\" for\n"
+           << "                      16 (default: the widest the CPU supports).\n"
+           << "  --output <path>     Output image, .ppm or .png (default: frame.ppm). With several\n"
+           << "                      frames, the frame number is appended to the file name.\n"
+           << "\n"
+           << "Benchmark:\n"
+           << "  --benchmark         Renders every scene while the camera orbits the target and\n"
+           << "                      reports frame time statistics, on the CPU with --headless.\n"
+           << "  --benchmark-frames <count>\n"
+           << "                      Number of measured frames per scene (default: 120).\n"
+           << "  --benchmark-output <path>\n"
+           << "                      Path of the JSON report (default: benchmark.json).\n"
+           << "  --compare-steps     Counts the steps of one ray per pixel in every scene with\n"
+           << "                      plain and over-relaxed sphere tracing, on the CPU.\n"
+           << "\n"
+           << "Profiling:\n"
+           << "  --gpu-log <path>    Logs the GPU time of every frame to a CSV file. Press F3 in the\n"
+           << "                      window to show the graph of the last frame times.\n"
+           << "\n"
+           << "Dynamic resolution:\n"
+           << "  --dynamic-resolution\n"
+           << "                      Lowers the resolution of the scene when the GPU frame time\n"
+           << "                      exceeds the target and upsamples it to the window. Press T in\n"
+           << "                      the window to toggle it.\n"
+           << "  --target-frame-time <ms>\n"
+           << "                      GPU frame time to aim for (default: 16.67).\n";
+}
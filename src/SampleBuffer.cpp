@@ -0,0 +1,113 @@
+/***************************************************************************************************
+ * @file  SampleBuffer.cpp
+ * @brief Implementation of the SampleBuffer class
+ **************************************************************************************************/
+
+#include "SampleBuffer.hpp"
+
+#include <glad/glad.h>
+#include <stdexcept>
+
+/**
+ * @brief Creates a texture with immutable storage.
+ * @param format The sized internal format of the texture.
+ * @param filter The filter used between texels, GL_NEAREST or GL_LINEAR.
+ * @param width The width of the texture in pixels.
+ * @param height The height of the texture in pixels.
+ * @return The texture's id.
+ */
+static unsigned int createTexture(GLenum format, GLint filter,
+                                  unsigned int width, unsigned int height) {
+    unsigned int texture;
+    glGenTextures(1, &texture);
+
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, format, width, height);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    return texture;
+}
+
+SampleBuffer::SampleBuffer(unsigned int width, unsigned int height)
+    : framebuffer(0), colors(0), geometry(0), width(width), height(height) {
+
+    glGenFramebuffers(1, &framebuffer);
+    allocate();
+}
+
+SampleBuffer::~SampleBuffer() {
+    glDeleteTextures(1, &colors);
+    glDeleteTextures(1, &geometry);
+    glDeleteFramebuffers(1, &framebuffer);
+}
+
+void SampleBuffer::resize(unsigned int width, unsigned int height) {
+    if(width == this->width && height == this->height) {
+        return;
+    }
+
+    this->width = width;
+    this->height = height;
+    allocate();
+}
+
+void SampleBuffer::bindFramebuffer() const {
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glViewport(0, 0, width, height);
+}
+
+void SampleBuffer::clear() const {
+    const float zeros[4] {0.0f, 0.0f, 0.0f, 0.0f};
+
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glClearBufferfv(GL_COLOR, 0, zeros);
+    glClearBufferfv(GL_COLOR, 1, zeros);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void SampleBuffer::blitColors(int width, int height) const {
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+    glReadBuffer(GL_COLOR_ATTACHMENT0);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+    glBlitFramebuffer(0, 0, this->width, this->height, 0, 0, width, height,
+                      GL_COLOR_BUFFER_BIT, GL_LINEAR);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void SampleBuffer::bindTextures(unsigned int colorUnit, unsigned int geometryUnit) const {
+    glActiveTexture(GL_TEXTURE0 + colorUnit);
+    glBindTexture(GL_TEXTURE_2D, colors);
+    glActiveTexture(GL_TEXTURE0 + geometryUnit);
+    glBindTexture(GL_TEXTURE_2D, geometry);
+}
+
+void SampleBuffer::allocate() {
+    // Immutable storage can't be resized so the textures are created again
+    glDeleteTextures(1, &colors);
+    glDeleteTextures(1, &geometry);
+
+    // Half floats keep enough precision for the distances the edges are found from. The temporal
+    // accumulation samples the colors between texels when the camera moves.
+    colors = createTexture(GL_RGBA16F, GL_LINEAR, width, height);
+    geometry = createTexture(GL_RGBA16F, GL_NEAREST, width, height);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, colors, 0);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, geometry, 0);
+
+    const GLenum drawBuffers[] {GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1};
+    glDrawBuffers(2, drawBuffers);
+
+    const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    if(status != GL_FRAMEBUFFER_COMPLETE) {
+        throw std::runtime_error("The anti-aliasing sample buffer's framebuffer is incomplete.");
+    }
+
+    // The content of new textures is undefined and the accumulation would read it as history
+    clear();
+}
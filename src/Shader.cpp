@@ -6,52 +6,288 @@
 #include "Shader.hpp"
 
 #include <glad/glad.h>
+#include <algorithm>
+#include <cstdint>
 #include <fstream>
+#include <iomanip>
 #include <sstream>
 
-std::string preprocessShader(const std::filesystem::path& path) {
-    if(!std::filesystem::exists(path)) {
-        throw std::runtime_error("File \"" + path.string() + "\" was not found.");
+/**
+ * @brief Hashes a string with the 64 bit FNV-1a, which unlike std::hash is the same on every run.
+ * @param string The string.
+ * @return The hash.
+ */
+static uint64_t hashString(const std::string& string) {
+    uint64_t hash = 0xcbf29ce484222325;
+    for(unsigned char character: string) {
+        hash ^= character;
+        hash *= 0x100000001b3;
     }
 
-    const std::string folder = path.parent_path();
+    return hash;
+}
 
-    std::ifstream file(path);
-    if(!file.is_open()) {
-        throw std::runtime_error("Couldn't open \"" + path.string() + "\".");
+std::filesystem::path getProgramBinaryPath(const std::string& vertexShaderPath,
+                                           const std::string& fragmentShaderPath,
+                                           const std::vector<std::string>& defines) {
+    std::string key = vertexShaderPath + '\0' + fragmentShaderPath;
+    for(const std::string& define: defines) {
+        key += '\0';
+        key += define;
     }
 
-    std::stringstream output;
-    std::string line;
+    std::ostringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << hashString(key) << ".bin";
 
-    while(std::getline(file, line)) {
-        if(line.contains("#include")) {
-            unsigned int first = line.find_first_of('"') + 1;
-            unsigned int last = line.find_last_of('"');
-            const std::string includePath = folder + '/' + line.substr(first, last - first);
+    return std::filesystem::path(PROGRAM_CACHE_DIRECTORY) / name.str();
+}
 
-            output << preprocessShader(includePath) << '\n';
-        } else {
-            output << line << '\n';
-        }
+uint64_t getProgramSourceHash(const std::string& vertexShaderCode,
+                              const std::string& fragmentShaderCode) {
+    // Binaries only work with the driver that produced them
+    std::string key;
+    for(GLenum name: {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+        key += reinterpret_cast<const char*>(glGetString(name));
+        key += '\n';
     }
 
-    if(path.extension() == ".frag") {
-        std::ofstream oFile("temp/fragment_shader.frag");
-        oFile << output.str();
+    key += vertexShaderCode;
+    key += '\0';
+    key += fragmentShaderCode;
+
+    return hashString(key);
+}
+
+Shader::Shader(const std::string& vertexShaderPath, const std::string& fragmentShaderPath,
+               const std::vector<std::string>& defines)
+    : id(0) {
+
+    const ShaderSource vertexShader = preprocessShader(vertexShaderPath);
+    const ShaderSource fragmentShader = preprocessShader(fragmentShaderPath, defines);
+
+    const std::filesystem::path binaryPath = getProgramBinaryPath(vertexShaderPath,
+                                                                  fragmentShaderPath, defines);
+    const uint64_t sourceHash = getProgramSourceHash(vertexShader.code, fragmentShader.code);
+
+    if(!loadProgramBinary(binaryPath, sourceHash)) {
+        compile(vertexShader, fragmentShader);
+        saveProgramBinary(binaryPath, sourceHash);
+    }
+
+    sourceFiles = vertexShader.files;
+    sourceFiles.insert(sourceFiles.end(), fragmentShader.files.begin(), fragmentShader.files.end());
+
+    cacheUniformLocations();
+}
+
+Shader::~Shader() {
+    glDeleteProgram(id);
+}
+
+void Shader::use() {
+    glUseProgram(id);
+}
+
+bool Shader::isMadeOf(const std::filesystem::path& file) const {
+    const std::filesystem::path normalFile = file.lexically_normal();
+
+    return std::find(sourceFiles.begin(), sourceFiles.end(), normalFile) != sourceFiles.end();
+}
+
+int Shader::getUniformLocation(std::string_view uniform) const {
+    const auto iterator = uniformLocations.find(uniform);
+    if(iterator != uniformLocations.end()) {
+        return iterator->second;
     }
 
-    return output.str();
+    // Array elements other than the first and struct members aren't cached
+    return glGetUniformLocation(id, std::string(uniform).c_str());
+}
+
+void Shader::setUniform(std::string_view uniform, int value) const {
+    setUniform(getUniformLocation(uniform), value);
+}
+
+void Shader::setUniform(std::string_view uniform, unsigned int value) const {
+    setUniform(getUniformLocation(uniform), value);
+}
+
+void Shader::setUniform(std::string_view uniform, bool value) const {
+    setUniform(getUniformLocation(uniform), value);
+}
+
+void Shader::setUniform(std::string_view uniform, float value) const {
+    setUniform(getUniformLocation(uniform), value);
+}
+
+void Shader::setUniform(std::string_view uniform, float x, float y) const {
+    setUniform(getUniformLocation(uniform), x, y);
+}
+
+void Shader::setUniform(std::string_view uniform, float x, float y, float z) const {
+    setUniform(getUniformLocation(uniform), x, y, z);
+}
+
+void Shader::setUniform(std::string_view uniform, float x, float y, float z, float w) const {
+    setUniform(getUniformLocation(uniform), x, y, z, w);
+}
+
+void Shader::setUniform(std::string_view uniform, const vec2& vec) const {
+    setUniform(getUniformLocation(uniform), vec);
+}
+
+void Shader::setUniform(std::string_view uniform, const vec3& vec) const {
+    setUniform(getUniformLocation(uniform), vec);
+}
+
+void Shader::setUniform(std::string_view uniform, const vec4& vec) const {
+    setUniform(getUniformLocation(uniform), vec);
+}
+
+void Shader::setUniform(std::string_view uniform, const std::vector<float>& values) const {
+    setUniform(getUniformLocation(uniform), values);
+}
+
+void Shader::setUniform(std::string_view uniform, const Matrix4& matrix) const {
+    setUniform(getUniformLocation(uniform), matrix);
+}
+
+void Shader::getUniform(std::string_view uniform, int& value) const {
+    getUniform(getUniformLocation(uniform), value);
+}
+
+void Shader::getUniform(std::string_view uniform, unsigned int& value) const {
+    getUniform(getUniformLocation(uniform), value);
+}
+
+void Shader::getUniform(std::string_view uniform, bool& value) const {
+    getUniform(getUniformLocation(uniform), value);
+}
+
+void Shader::getUniform(std::string_view uniform, float& value) const {
+    getUniform(getUniformLocation(uniform), value);
+}
+
+void Shader::getUniform(std::string_view uniform, vec2& vec) const {
+    getUniform(getUniformLocation(uniform), vec);
+}
+
+void Shader::getUniform(std::string_view uniform, vec3& vec) const {
+    getUniform(getUniformLocation(uniform), vec);
+}
+
+void Shader::getUniform(std::string_view uniform, vec4& vec) const {
+    getUniform(getUniformLocation(uniform), vec);
+}
+
+void Shader::getUniform(std::string_view uniform, Matrix4& matrix) const {
+    getUniform(getUniformLocation(uniform), matrix);
+}
+
+void Shader::setUniform(int location, int value) const {
+    glUniform1i(location, value);
+}
+
+void Shader::setUniform(int location, unsigned int value) const {
+    glUniform1ui(location, value);
+}
+
+void Shader::setUniform(int location, bool value) const {
+    glUniform1i(location, static_cast<int>(value));
+}
+
+void Shader::setUniform(int location, float value) const {
+    glUniform1f(location, value);
+}
+
+void Shader::setUniform(int location, float x, float y) const {
+    glUniform2f(location, x, y);
+}
+
+void Shader::setUniform(int location, float x, float y, float z) const {
+    glUniform3f(location, x, y, z);
+}
+
+void Shader::setUniform(int location, float x, float y, float z, float w) const {
+    glUniform4f(location, x, y, z, w);
+}
+
+void Shader::setUniform(int location, const vec2& vec) const {
+    glUniform2fv(location, 1, &vec.x);
+}
+
+void Shader::setUniform(int location, const vec3& vec) const {
+    glUniform3fv(location, 1, &vec.x);
+}
+
+void Shader::setUniform(int location, const vec4& vec) const {
+    glUniform4fv(location, 1, &vec.x);
+}
+
+void Shader::setUniform(int location, const std::vector<float>& values) const {
+    glUniform1fv(location, values.size(), values.data());
+}
+
+void Shader::setUniform(int location, const Matrix4& matrix) const {
+    glUniformMatrix4fv(location, 1, true, &(matrix[0][0]));
+}
+
+void Shader::getUniform(int location, int& value) const {
+    glGetUniformiv(id, location, &value);
+}
+
+void Shader::getUniform(int location, unsigned int& value) const {
+    glGetUniformuiv(id, location, &value);
 }
 
-Shader::Shader(const std::string& vertexShaderPath, const std::string& fragmentShaderPath) {
+void Shader::getUniform(int location, bool& value) const {
+    int v;
+    glGetUniformiv(id, location, &v);
+    value = v;
+}
+
+void Shader::getUniform(int location, float& value) const {
+    glGetUniformfv(id, location, &value);
+}
+
+void Shader::getUniform(int location, vec2& vec) const {
+    glGetUniformfv(id, location, &vec.x);
+}
+
+void Shader::getUniform(int location, vec3& vec) const {
+    glGetUniformfv(id, location, &vec.x);
+}
+
+void Shader::getUniform(int location, vec4& vec) const {
+    glGetUniformfv(id, location, &vec.x);
+}
+
+void Shader::getUniform(int location, Matrix4& matrix) const {
+    glGetUniformfv(id, location, &(matrix[0][0]));
+}
+
+void Shader::compile(const ShaderSource& vertexShader, const ShaderSource& fragmentShader) {
+    // Deletes what was created when leaving, whether by returning or by throwing. The program is
+    // released on success, and deleting 0 is ignored.
+    struct Objects {
+        unsigned int vertexShaderID = 0;
+        unsigned int fragmentShaderID = 0;
+        unsigned int programID = 0;
+
+        ~Objects() {
+            glDeleteShader(vertexShaderID);
+            glDeleteShader(fragmentShaderID);
+            glDeleteProgram(programID);
+        }
+    } objects;
+
     int messageLength;
 
     /**** Vertex Shader ****/
-    std::string vertexShaderCode = preprocessShader(vertexShaderPath);
-    const char* vertexShader = vertexShaderCode.c_str();
+    const char* vertexShaderCode = vertexShader.code.c_str();
     unsigned int vertexShaderID = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShaderID, 1, &vertexShader, nullptr);
+    objects.vertexShaderID = vertexShaderID;
+    glShaderSource(vertexShaderID, 1, &vertexShaderCode, nullptr);
     glCompileShader(vertexShaderID);
 
     glGetShaderiv(vertexShaderID, GL_INFO_LOG_LENGTH, &messageLength);
@@ -61,6 +297,7 @@ Shader::Shader(const std::string& vertexShaderPath, const std::string& fragmentS
 
         std::string errorMessage = "Failed to compile vertex shader :\n";
         errorMessage += message;
+        errorMessage += "Source strings :\n" + getSourceStringNames(vertexShader);
 
         delete[] message;
 
@@ -68,10 +305,10 @@ Shader::Shader(const std::string& vertexShaderPath, const std::string& fragmentS
     }
 
     /**** Fragment Shader ****/
-    std::string fragmentShaderCode = preprocessShader(fragmentShaderPath);
-    const char* fragmentShader = fragmentShaderCode.c_str();
+    const char* fragmentShaderCode = fragmentShader.code.c_str();
     unsigned int fragmentShaderID = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShaderID, 1, &fragmentShader, nullptr);
+    objects.fragmentShaderID = fragmentShaderID;
+    glShaderSource(fragmentShaderID, 1, &fragmentShaderCode, nullptr);
     glCompileShader(fragmentShaderID);
 
     glGetShaderiv(fragmentShaderID, GL_INFO_LOG_LENGTH, &messageLength);
@@ -81,6 +318,7 @@ Shader::Shader(const std::string& vertexShaderPath, const std::string& fragmentS
 
         std::string errorMessage = "Failed to compile fragment shader :\n";
         errorMessage += message;
+        errorMessage += "Source strings :\n" + getSourceStringNames(fragmentShader);
 
         delete[] message;
 
@@ -88,18 +326,17 @@ Shader::Shader(const std::string& vertexShaderPath, const std::string& fragmentS
     }
 
     /**** Shader Program ****/
-    id = glCreateProgram();
-    glAttachShader(id, vertexShaderID);
-    glAttachShader(id, fragmentShaderID);
-    glLinkProgram(id);
-
-    glDeleteShader(vertexShaderID);
-    glDeleteShader(fragmentShaderID);
-
-    glGetProgramiv(id, GL_INFO_LOG_LENGTH, &messageLength);
+    unsigned int programID = glCreateProgram();
+    objects.programID = programID;
+    glAttachShader(programID, vertexShaderID);
+    glAttachShader(programID, fragmentShaderID);
+    glProgramParameteri(programID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glLinkProgram(programID);
+
+    glGetProgramiv(programID, GL_INFO_LOG_LENGTH, &messageLength);
     if(messageLength > 0) {
         char* message = new char[messageLength];
-        glGetProgramInfoLog(id, messageLength, nullptr, message);
+        glGetProgramInfoLog(programID, messageLength, nullptr, message);
 
         std::string errorMessage = "Failed to link shader program :\n";
         errorMessage += message;
@@ -108,90 +345,106 @@ Shader::Shader(const std::string& vertexShaderPath, const std::string& fragmentS
 
         throw std::runtime_error(errorMessage);
     }
-}
 
-Shader::~Shader() {
-    glDeleteProgram(id);
+    id = programID;
+    objects.programID = 0;
 }
 
-void Shader::use() {
-    glUseProgram(id);
-}
+bool Shader::loadProgramBinary(const std::filesystem::path& path, uint64_t sourceHash) {
+    std::ifstream file(path, std::ios::binary);
+    if(!file.is_open()) {
+        return false;
+    }
 
-void Shader::setUniform(const std::string& uniform, int value) const {
-    glUniform1i(glGetUniformLocation(id, uniform.c_str()), value);
-}
+    // A binary of an older version of the sources or made by another driver is a miss
+    uint64_t binarySourceHash;
+    if(!file.read(reinterpret_cast<char*>(&binarySourceHash), sizeof(binarySourceHash))
+       || binarySourceHash != sourceHash) {
+        return false;
+    }
 
-void Shader::setUniform(const std::string& uniform, unsigned int value) const {
-    glUniform1ui(glGetUniformLocation(id, uniform.c_str()), value);
-}
+    GLenum format;
+    if(!file.read(reinterpret_cast<char*>(&format), sizeof(format))) {
+        return false;
+    }
 
-void Shader::setUniform(const std::string& uniform, bool value) const {
-    glUniform1i(glGetUniformLocation(id, uniform.c_str()), static_cast<int>(value));
-}
+    const std::vector<char> binary((std::istreambuf_iterator<char>(file)),
+                                   std::istreambuf_iterator<char>());
 
-void Shader::setUniform(const std::string& uniform, float value) const {
-    glUniform1f(glGetUniformLocation(id, uniform.c_str()), value);
-}
+    id = glCreateProgram();
+    glProgramBinary(id, format, binary.data(), binary.size());
 
-void Shader::setUniform(const std::string& uniform, float x, float y) const {
-    glUniform2f(glGetUniformLocation(id, uniform.c_str()), x, y);
-}
+    // Drivers may reject binaries they didn't produce, the program is then compiled again
+    int status;
+    glGetProgramiv(id, GL_LINK_STATUS, &status);
+    if(status == GL_FALSE) {
+        glDeleteProgram(id);
+        id = 0;
 
-void Shader::setUniform(const std::string& uniform, float x, float y, float z) const {
-    glUniform3f(glGetUniformLocation(id, uniform.c_str()), x, y, z);
-}
+        return false;
+    }
 
-void Shader::setUniform(const std::string& uniform, float x, float y, float z, float w) const {
-    glUniform4f(glGetUniformLocation(id, uniform.c_str()), x, y, z, w);
+    return true;
 }
 
-void Shader::setUniform(const std::string& uniform, const vec2& vec) const {
-    glUniform2fv(glGetUniformLocation(id, uniform.c_str()), 1, &vec.x);
-}
+void Shader::saveProgramBinary(const std::filesystem::path& path, uint64_t sourceHash) const {
+    int length;
+    glGetProgramiv(id, GL_PROGRAM_BINARY_LENGTH, &length);
+    if(length <= 0) {
+        return;
+    }
 
-void Shader::setUniform(const std::string& uniform, const vec3& vec) const {
-    glUniform3fv(glGetUniformLocation(id, uniform.c_str()), 1, &vec.x);
-}
+    GLenum format;
+    std::vector<char> binary(length);
+    glGetProgramBinary(id, length, nullptr, &format, binary.data());
 
-void Shader::setUniform(const std::string& uniform, const vec4& vec) const {
-    glUniform4fv(glGetUniformLocation(id, uniform.c_str()), 1, &vec.x);
-}
+    // The cache is only an optimization so failing to write it isn't an error
+    std::error_code error;
+    std::filesystem::create_directories(path.parent_path(), error);
 
-void Shader::setUniform(const std::string& uniform, const Matrix4& matrix) const {
-    glUniformMatrix4fv(glGetUniformLocation(id, uniform.c_str()), 1, true, &(matrix[0][0]));
-}
+    // Written next to the final file then renamed so a crash never leaves a truncated binary
+    std::filesystem::path temporaryPath = path;
+    temporaryPath += ".tmp";
 
-void Shader::getUniform(const std::string& uniform, int& value) const {
-    glGetUniformiv(id, glGetUniformLocation(id, uniform.c_str()), &value);
-}
+    std::ofstream file(temporaryPath, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(&sourceHash), sizeof(sourceHash));
+    file.write(reinterpret_cast<const char*>(&format), sizeof(format));
+    file.write(binary.data(), binary.size());
+    file.close();
 
-void Shader::getUniform(const std::string& uniform, unsigned int& value) const {
-    glGetUniformuiv(id, glGetUniformLocation(id, uniform.c_str()), &value);
+    if(file) {
+        std::filesystem::rename(temporaryPath, path, error);
+    } else {
+        std::filesystem::remove(temporaryPath, error);
+    }
 }
 
-void Shader::getUniform(const std::string& uniform, bool& value) const {
-    int v;
-    glGetUniformiv(id, glGetUniformLocation(id, uniform.c_str()), &v);
-    value = v;
-}
+void Shader::cacheUniformLocations() {
+    uniformLocations.clear();
 
-void Shader::getUniform(const std::string& uniform, float& value) const {
-    glGetUniformfv(id, glGetUniformLocation(id, uniform.c_str()), &value);
-}
+    int count, maxLength;
+    glGetProgramiv(id, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
 
-void Shader::getUniform(const std::string& uniform, vec2& vec) const {
-    glGetUniformfv(id, glGetUniformLocation(id, uniform.c_str()), &vec.x);
-}
+    std::string name(maxLength, '\0');
+    for(int i = 0 ; i < count ; ++i) {
+        int length, size;
+        unsigned int type;
+        glGetActiveUniform(id, i, maxLength, &length, &size, &type, name.data());
 
-void Shader::getUniform(const std::string& uniform, vec3& vec) const {
-    glGetUniformfv(id, glGetUniformLocation(id, uniform.c_str()), &vec.x);
-}
+        const std::string uniform = name.substr(0, length);
+        const int location = glGetUniformLocation(id, uniform.c_str());
 
-void Shader::getUniform(const std::string& uniform, vec4& vec) const {
-    glGetUniformfv(id, glGetUniformLocation(id, uniform.c_str()), &vec.x);
-}
+        // Uniforms in blocks have no location
+        if(location == -1) {
+            continue;
+        }
 
-void Shader::getUniform(const std::string& uniform, Matrix4& matrix) const {
-    glGetUniformfv(id, glGetUniformLocation(id, uniform.c_str()), &(matrix[0][0]));
-}
\ No newline at end of file
+        uniformLocations[uniform] = location;
+
+        // Arrays are listed as "name[0]" but are usually set with just their name
+        if(uniform.ends_with("[0]")) {
+            uniformLocations[uniform.substr(0, uniform.size() - 3)] = location;
+        }
+    }
+}
@@ -0,0 +1,115 @@
+/***************************************************************************************************
+ * @file  ShaderCompiler.cpp
+ * @brief Implementation of the ShaderCompiler class
+ **************************************************************************************************/
+
+#include "ShaderCompiler.hpp"
+
+#include <stdexcept>
+
+ShaderCompiler::ShaderCompiler(GLFWwindow* window)
+    : context(nullptr), generation(0), isRunning(true) {
+
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    context = glfwCreateWindow(1, 1, "Shader Compiler", nullptr, window);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+
+    if(!context) {
+        throw std::runtime_error("Failed to create the shader compiler's context.");
+    }
+
+    worker = std::thread(&ShaderCompiler::work, this);
+}
+
+ShaderCompiler::~ShaderCompiler() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        isRunning = false;
+    }
+
+    condition.notify_one();
+    worker.join();
+
+    for(const CompiledShader& result: results) {
+        delete result.shader;
+    }
+
+    glfwDestroyWindow(context);
+}
+
+void ShaderCompiler::request(const ShaderRequest& request) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        requests.push_back(request);
+    }
+
+    condition.notify_one();
+}
+
+void ShaderCompiler::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    requests.clear();
+    ++generation;
+
+    for(const CompiledShader& result: results) {
+        delete result.shader;
+    }
+
+    results.clear();
+}
+
+bool ShaderCompiler::getResult(CompiledShader& result) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if(results.empty()) {
+        return false;
+    }
+
+    result = results.front();
+    results.pop_front();
+
+    return true;
+}
+
+void ShaderCompiler::work() {
+    glfwMakeContextCurrent(context);
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while(true) {
+        condition.wait(lock, [this] { return !isRunning || !requests.empty(); });
+
+        if(!isRunning) {
+            break;
+        }
+
+        const ShaderRequest request = requests.front();
+        requests.pop_front();
+        const unsigned int requestGeneration = generation;
+
+        lock.unlock();
+
+        CompiledShader result{request.key, nullptr, ""};
+        try {
+            result.shader = new Shader(request.vertexShaderPath, request.fragmentShaderPath,
+                                       request.defines);
+
+            // The program must be complete before another context uses it
+            glFinish();
+        } catch(const std::exception& exception) {
+            result.error = exception.what();
+        }
+
+        lock.lock();
+
+        if(requestGeneration == generation) {
+            results.push_back(result);
+        } else {
+            delete result.shader;
+        }
+    }
+
+    lock.unlock();
+    glfwMakeContextCurrent(nullptr);
+}
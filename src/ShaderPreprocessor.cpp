@@ -0,0 +1,217 @@
+/***************************************************************************************************
+ * @file  ShaderPreprocessor.cpp
+ * @brief Implementation of the shader preprocessor
+ **************************************************************************************************/
+
+#include "ShaderPreprocessor.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+/**
+ * @struct SourceFile
+ * @brief The parsed content of a shader file.
+ */
+struct SourceFile {
+    std::filesystem::file_time_type modificationTime; ///< When the file was read.
+    std::vector<std::string> lines;                   ///< The lines of the file.
+    std::vector<std::string> includes; ///< For each line, the file it includes or an empty string.
+    bool isIncludedOnce;               ///< Whether the file has '#pragma once' or a guard.
+};
+
+static std::mutex sourceFilesMutex; ///< Guards sourceFiles, shaders are compiled on two threads.
+static std::unordered_map<std::string, std::shared_ptr<const SourceFile>> sourceFiles; ///< Cache.
+
+/**
+ * @brief Gets the word following a directive.
+ * @param line The line of the directive, without leading whitespace.
+ * @param directive The directive, such as "#ifndef".
+ * @return The word, or an empty string if the line isn't that directive.
+ */
+static std::string getDirectiveArgument(const std::string& line, const std::string& directive) {
+    if(!line.starts_with(directive)) {
+        return "";
+    }
+
+    std::istringstream stream(line.substr(directive.size()));
+    std::string argument;
+    stream >> argument;
+
+    return argument;
+}
+
+/**
+ * @brief Reads and parses a shader file.
+ * @param path The file's path.
+ * @param modificationTime When the file was last modified.
+ * @return The parsed file.
+ */
+static std::shared_ptr<const SourceFile> readSourceFile(
+    const std::filesystem::path& path, std::filesystem::file_time_type modificationTime) {
+    std::ifstream stream(path);
+    if(!stream.is_open()) {
+        throw std::runtime_error("Couldn't open \"" + path.string() + "\".");
+    }
+
+    auto file = std::make_shared<SourceFile>();
+    file->modificationTime = modificationTime;
+    file->isIncludedOnce = false;
+
+    std::string guard;
+    unsigned int directiveCount = 0;
+
+    std::string line;
+    while(std::getline(stream, line)) {
+        const size_t start = line.find_first_not_of(" \t");
+        const std::string trimmed = start == std::string::npos ? "" : line.substr(start);
+        std::string include;
+
+        if(trimmed.starts_with("#include")) {
+            const size_t first = trimmed.find_first_of('"');
+            const size_t last = trimmed.find_last_of('"');
+
+            if(first == std::string::npos || last == first) {
+                throw std::runtime_error("Invalid include in \"" + path.string() + "\" at line "
+                                         + std::to_string(file->lines.size() + 1) + '.');
+            }
+
+            include = trimmed.substr(first + 1, last - first - 1);
+        } else if(trimmed.starts_with("#pragma once")) {
+            file->isIncludedOnce = true;
+            line.clear(); // Not a glsl directive, the line is kept empty so numbers don't shift
+        } else if(trimmed.starts_with('#')) {
+            // A guard is an '#ifndef' directly followed by the '#define' of the same macro
+            if(directiveCount == 0) {
+                guard = getDirectiveArgument(trimmed, "#ifndef");
+            } else if(directiveCount == 1 && !guard.empty()
+                      && getDirectiveArgument(trimmed, "#define") == guard) {
+                file->isIncludedOnce = true;
+            }
+
+            ++directiveCount;
+        }
+
+        file->lines.push_back(line);
+        file->includes.push_back(include);
+    }
+
+    return file;
+}
+
+/**
+ * @brief Gets a shader file from the cache, reading it again only if it was modified since.
+ * @param path The file's path.
+ * @return The parsed file.
+ */
+static std::shared_ptr<const SourceFile> getSourceFile(const std::filesystem::path& path) {
+    std::error_code error;
+    const std::filesystem::file_time_type modificationTime =
+        std::filesystem::last_write_time(path, error);
+
+    if(error) {
+        throw std::runtime_error("File \"" + path.string() + "\" was not found.");
+    }
+
+    std::lock_guard<std::mutex> lock(sourceFilesMutex);
+
+    std::shared_ptr<const SourceFile>& file = sourceFiles[path.string()];
+    if(!file || file->modificationTime != modificationTime) {
+        file = readSourceFile(path, modificationTime);
+    }
+
+    return file;
+}
+
+/**
+ * @brief Appends a file to a preprocessed shader, replacing its includes with the included files.
+ * @param path The file's path.
+ * @param defines The macros to define after the '#version' directive of the first file.
+ * @param stack The files being appended, to detect recursive includes.
+ * @param source The preprocessed shader.
+ * @param output The stream the code is written to.
+ */
+static void appendSourceFile(const std::filesystem::path& path,
+                             const std::vector<std::string>& defines,
+                             std::vector<std::filesystem::path>& stack,
+                             ShaderSource& source,
+                             std::ostringstream& output) {
+    const std::shared_ptr<const SourceFile> file = getSourceFile(path);
+    const size_t index = source.files.size();
+
+    source.files.push_back(path);
+    stack.push_back(path);
+
+    // '#line' can't come before '#version' so the first file starts without one
+    if(index > 0) {
+        output << "#line 1 " << index << '\n';
+    }
+
+    for(size_t i = 0 ; i < file->lines.size() ; ++i) {
+        if(file->includes[i].empty()) {
+            output << file->lines[i] << '\n';
+
+            if(index == 0 && file->lines[i].starts_with("#version")) {
+                for(const std::string& define: defines) {
+                    output << "#define " << define << '\n';
+                }
+
+                output << "#line " << i + 2 << " 0\n";
+            }
+
+            continue;
+        }
+
+        const std::filesystem::path includePath =
+            (path.parent_path() / file->includes[i]).lexically_normal();
+
+        if(std::find(stack.begin(), stack.end(), includePath) != stack.end()) {
+            throw std::runtime_error("\"" + includePath.string() + "\" includes itself through \""
+                                     + path.string() + "\".");
+        }
+
+        const bool isIncluded = std::find(source.files.begin(), source.files.end(), includePath)
+                                != source.files.end();
+
+        if(isIncluded && getSourceFile(includePath)->isIncludedOnce) {
+            output << '\n';
+        } else {
+            appendSourceFile(includePath, defines, stack, source, output);
+            output << "#line " << i + 2 << ' ' << index << '\n';
+        }
+    }
+
+    stack.pop_back();
+}
+
+ShaderSource preprocessShader(const std::filesystem::path& path,
+                              const std::vector<std::string>& defines) {
+    ShaderSource source;
+    std::vector<std::filesystem::path> stack;
+    std::ostringstream output;
+
+    appendSourceFile(path.lexically_normal(), defines, stack, source, output);
+    source.code = output.str();
+
+    // The other programs are compiled on another thread and would write the file concurrently
+    if(path.filename() == "default.frag" && defines.empty()) {
+        std::ofstream oFile("temp/fragment_shader.frag");
+        oFile << source.code;
+    }
+
+    return source;
+}
+
+std::string getSourceStringNames(const ShaderSource& source) {
+    std::ostringstream names;
+
+    for(size_t i = 0 ; i < source.files.size() ; ++i) {
+        names << "  " << i << ": " << source.files[i].string() << '\n';
+    }
+
+    return names.str();
+}
@@ -0,0 +1,55 @@
+/***************************************************************************************************
+ * @file  ShaderWatcher.cpp
+ * @brief Implementation of the ShaderWatcher class
+ **************************************************************************************************/
+
+#include "ShaderWatcher.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+ShaderWatcher::ShaderWatcher(const std::filesystem::path& directory)
+    : directory(directory), descriptor(-1) {
+
+    descriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if(descriptor == -1) {
+        throw std::runtime_error("Failed to initialize inotify.");
+    }
+
+    if(inotify_add_watch(descriptor, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) == -1) {
+        close(descriptor);
+        throw std::runtime_error("Couldn't watch \"" + directory.string() + "\".");
+    }
+}
+
+ShaderWatcher::~ShaderWatcher() {
+    close(descriptor);
+}
+
+std::vector<std::filesystem::path> ShaderWatcher::getModifiedFiles() {
+    std::vector<std::filesystem::path> files;
+
+    alignas(inotify_event) char buffer[4096];
+    ssize_t length;
+
+    // The descriptor is non-blocking so reading stops as soon as no event is left
+    while((length = read(descriptor, buffer, sizeof(buffer))) > 0) {
+        for(ssize_t offset = 0 ; offset < length ;) {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            offset += sizeof(inotify_event) + event->len;
+
+            if(event->len == 0) {
+                continue;
+            }
+
+            const std::filesystem::path file = (directory / event->name).lexically_normal();
+            if(std::find(files.begin(), files.end(), file) == files.end()) {
+                files.push_back(file);
+            }
+        }
+    }
+
+    return files;
+}
@@ -0,0 +1,41 @@
+/***************************************************************************************************
+ * @file  StepHistogram.cpp
+ * @brief Implementation of the StepHistogram class
+ **************************************************************************************************/
+
+#include "StepHistogram.hpp"
+
+#include <glad/glad.h>
+
+constexpr unsigned int STEP_HISTOGRAM_SIZE =
+    STEP_HISTOGRAM_PASS_COUNT * STEP_HISTOGRAM_BIN_COUNT * sizeof(unsigned int);
+
+StepHistogram::StepHistogram() : id(0) {
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glBufferStorage(GL_SHADER_STORAGE_BUFFER, STEP_HISTOGRAM_SIZE, nullptr,
+                    GL_DYNAMIC_STORAGE_BIT);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, STEP_HISTOGRAM_BINDING, id);
+
+    clear();
+}
+
+StepHistogram::~StepHistogram() {
+    glDeleteBuffers(1, &id);
+}
+
+void StepHistogram::clear() {
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glClearBufferData(GL_SHADER_STORAGE_BUFFER, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+}
+
+std::vector<unsigned int> StepHistogram::read() const {
+    std::vector<unsigned int> bins(STEP_HISTOGRAM_PASS_COUNT * STEP_HISTOGRAM_BIN_COUNT);
+
+    // The atomic counters of the shaders must be visible to the read back
+    glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, id);
+    glGetBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, STEP_HISTOGRAM_SIZE, bins.data());
+
+    return bins;
+}
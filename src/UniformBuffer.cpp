@@ -0,0 +1,80 @@
+/***************************************************************************************************
+ * @file  UniformBuffer.cpp
+ * @brief Implementation of the UniformBuffer class
+ **************************************************************************************************/
+
+#include "UniformBuffer.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+UniformBuffer::UniformBuffer(unsigned int binding, unsigned int size)
+    : id(0), binding(binding), size(size), stride(0),
+      mapping(nullptr),
+      fences{}, section(UNIFORM_BUFFER_SECTION_COUNT - 1) {
+
+    int alignment;
+    glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+    stride = (size + alignment - 1) / alignment * alignment;
+
+    const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    glGenBuffers(1, &id);
+    glBindBuffer(GL_UNIFORM_BUFFER, id);
+    glBufferStorage(GL_UNIFORM_BUFFER, UNIFORM_BUFFER_SECTION_COUNT * stride, nullptr, flags);
+
+    mapping = static_cast<unsigned char*>(
+        glMapBufferRange(GL_UNIFORM_BUFFER, 0, UNIFORM_BUFFER_SECTION_COUNT * stride, flags)
+    );
+
+    if(!mapping) {
+        glDeleteBuffers(1, &id);
+        throw std::runtime_error("Failed to map the uniform buffer.");
+    }
+}
+
+UniformBuffer::~UniformBuffer() {
+    for(GLsync fence: fences) {
+        if(fence) {
+            glDeleteSync(fence);
+        }
+    }
+
+    glBindBuffer(GL_UNIFORM_BUFFER, id);
+    glUnmapBuffer(GL_UNIFORM_BUFFER);
+    glDeleteBuffers(1, &id);
+}
+
+void UniformBuffer::write(const void* data) {
+    // Every command using the current copy was issued before this call
+    if(fences[section]) {
+        glDeleteSync(fences[section]);
+    }
+    fences[section] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    section = (section + 1) % UNIFORM_BUFFER_SECTION_COUNT;
+
+    if(fences[section]) {
+        GLbitfield waitFlags = 0;
+        GLuint64 timeout = 0;
+
+        while(true) {
+            const GLenum result = glClientWaitSync(fences[section], waitFlags, timeout);
+            if(result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED) {
+                break;
+            } else if(result == GL_WAIT_FAILED) {
+                throw std::runtime_error("Failed to wait for the uniform buffer.");
+            }
+
+            // Not done yet: make sure the fence gets submitted, then wait up to 1 second at a time
+            waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+            timeout = 1'000'000'000;
+        }
+
+        glDeleteSync(fences[section]);
+        fences[section] = nullptr;
+    }
+
+    std::memcpy(mapping + section * stride, data, size);
+    glBindBufferRange(GL_UNIFORM_BUFFER, binding, id, section * stride, size);
+}
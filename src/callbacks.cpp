@@ -6,7 +6,7 @@
 #include "callbacks.hpp"
 
 void windowSizeCallback(GLFWwindow* /* window */, int width, int height) {
-    app.setWindowSize(width, height);
+    app->setWindowSize(width, height);
 }
 
 void frameBufferSizeCallback(GLFWwindow* /* window */, int width, int height) {
@@ -14,9 +14,9 @@ void frameBufferSizeCallback(GLFWwindow* /* window */, int width, int height) {
 }
 
 void keyCallback(GLFWwindow* /* window */, int key, int /* scancode */, int action, int mods) {
-    app.handleKeyCallback(key, action, mods);
+    app->handleKeyCallback(key, action, mods);
 }
 
 void cursorPositionCallback(GLFWwindow* /* window */, double xPos, double yPos) {
-    app.handleCursorPositionEvent(xPos, yPos);
+    app->handleCursorPositionEvent(xPos, yPos);
 }
\ No newline at end of file
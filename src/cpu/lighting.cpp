@@ -0,0 +1,106 @@
+/***************************************************************************************************
+ * @file  lighting.cpp
+ * @brief Implementation of the lighting functions of shaders/lighting.glsl
+ **************************************************************************************************/
+
+#include "cpu/lighting.hpp"
+
+#include <cmath>
+#include "maths/common.hpp"
+#include "maths/geometry.hpp"
+
+static const Point LIGHT_POSITION = 30.0f * Point(2.5f, 7.5f, 2.5f);
+
+Vector getCentralNormal(const Point& pos, const Uniforms& uniforms) {
+    const Vector epsilonX(MIN_DISTANCE, 0.0f, 0.0f);
+    const Vector epsilonY(0.0f, MIN_DISTANCE, 0.0f);
+    const Vector epsilonZ(0.0f, 0.0f, MIN_DISTANCE);
+
+    Vector normal;
+    normal.x = mapDistance(pos + epsilonX, uniforms) - mapDistance(pos - epsilonX, uniforms);
+    normal.y = mapDistance(pos + epsilonY, uniforms) - mapDistance(pos - epsilonY, uniforms);
+    normal.z = mapDistance(pos + epsilonZ, uniforms) - mapDistance(pos - epsilonZ, uniforms);
+
+    return normalize(normal);
+}
+
+Vector getTetrahedralNormal(const Point& pos, const Uniforms& uniforms) {
+    const Vector a(1.0f, -1.0f, -1.0f);
+    const Vector b(-1.0f, -1.0f, 1.0f);
+    const Vector c(-1.0f, 1.0f, -1.0f);
+    const Vector d(1.0f, 1.0f, 1.0f);
+
+    return normalize(a * mapDistance(pos + a * MIN_DISTANCE, uniforms)
+                     + b * mapDistance(pos + b * MIN_DISTANCE, uniforms)
+                     + c * mapDistance(pos + c * MIN_DISTANCE, uniforms)
+                     + d * mapDistance(pos + d * MIN_DISTANCE, uniforms));
+}
+
+Vector getNormal(const Point& pos, const Uniforms& uniforms) {
+    return uniforms.normalMethod == NormalMethod::tetrahedral
+           ? getTetrahedralNormal(pos, uniforms)
+           : getCentralNormal(pos, uniforms);
+}
+
+float getSoftShadow(const Point& pos, const Uniforms& uniforms) {
+    const Vector lightPos = normalize(LIGHT_POSITION);
+    const float lightSize = 0.05f;
+
+    float distance;
+    float distanceFromOrigin = 0.0f;
+    float res = 1.0f;
+
+    for(unsigned int i = 0u ; i < MAX_STEPS ; ++i) {
+        distance = mapDistance(pos + lightPos * distanceFromOrigin, uniforms);
+        res = fminf(res, distance / (distanceFromOrigin * lightSize));
+        distanceFromOrigin += distance;
+
+        if(fabsf(distance) < MIN_DISTANCE || distanceFromOrigin > MAX_DISTANCE) {
+            break;
+        }
+    }
+
+    return clamp(res, 0.0f, 1.0f);
+}
+
+float getAmbientOcclusion(const Point& pos, const Vector& normal, const Uniforms& uniforms) {
+    float occlusion = 0.0f;
+    const float weight = 1.0f;
+
+    for(unsigned int i = 0u ; i < 8u ; ++i) {
+        const float len = 0.01f + 0.02f * static_cast<float>(i * i);
+        const float distance = mapDistance(pos + normal * len, uniforms);
+        occlusion += (len - distance) * weight;
+    }
+
+    return 1.0f - clamp(0.6f * occlusion, 0.0f, 1.0f);
+}
+
+Color phongLighting(const Ray& ray, const Point& pos, const Vector& normal,
+                    const Uniforms& uniforms) {
+    // Ambient Lighting
+    const float ambient = 0.2f;
+
+    // Diffuse Lighting
+    const Vector lightDirection = normalize(LIGHT_POSITION - pos);
+    const float diffuse = clamp(dot(normal, lightDirection), 0.0f, 1.0f);
+
+    // Specular lighting
+    const Vector reflectionDir = reflect(-1.0f * lightDirection, normal);
+    const float specular = 0.25f * powf(fmaxf(dot(-1.0f * ray.direction, reflectionDir), 0.0f),
+                                        32.0f);
+
+    // Fresnel Effect
+    float fresnel = 1.0f + dot(ray.direction, normal);
+    fresnel = 0.25f * fresnel * fresnel * fresnel;
+
+    // Shadows
+    const float shadows = hasShadows(uniforms.active_scene)
+                          ? getSoftShadow(pos + normal * 0.02f, uniforms)
+                          : 1.0f;
+
+    // Ambient Occlusion
+    const float occlusion = getAmbientOcclusion(pos, normal, uniforms);
+
+    return Color(occlusion * (ambient + fresnel) + shadows * (diffuse + occlusion * specular));
+}
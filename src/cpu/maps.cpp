@@ -0,0 +1,642 @@
+/***************************************************************************************************
+ * @file  maps.cpp
+ * @brief Implementation of the raymarching scenes of shaders/maps.glsl
+ **************************************************************************************************/
+
+#include "cpu/maps.hpp"
+
+#include <cmath>
+#include "cpu/signed_distance_functions.hpp"
+#include "cpu/transformations.hpp"
+#include "cpu/utility.hpp"
+#include "maths/common.hpp"
+#include "maths/trigonometry.hpp"
+
+static const Color RED(1.0f, 0.0f, 0.0f);
+static const Color GREEN(0.0f, 1.0f, 0.0f);
+static const Color BLUE(0.0f, 0.0f, 1.0f);
+
+/**
+ * @brief Packs a color and a signed distance the same way the GLSL scenes do.
+ * @param color The color of the shape.
+ * @param distance The signed distance to the shape.
+ * @return The color in the rgb components and the distance in w.
+ */
+static vec4 shape(const Color& color, float distance) {
+    return vec4(color.x, color.y, color.z, distance);
+}
+
+vec4 map1(const Point& pos, float time) {
+    Point p = pos;
+
+    const vec4 ground(0.45f, 0.35f, 0.9f, p.y);
+
+    p = pos;
+    p.y -= time * 0.5f;
+    p = fract(p) - 0.5f;
+    vec2 r = rotation2D(vec2(p.x, p.z), time);
+    p.x = r.x;
+    p.z = r.y;
+    r = rotation2D(vec2(p.z, p.y), time);
+    p.z = r.x;
+    p.y = r.y;
+    const vec4 box = shape(Color(0.333f, 0.25f, 0.666f), SDF_Box(p, vec3(0.1f)));
+
+    return unionSDF(ground, box);
+}
+
+float map1Distance(const Point& pos, float time) {
+    Point p = pos;
+    p.y -= time * 0.5f;
+    p = fract(p) - 0.5f;
+    vec2 r = rotation2D(vec2(p.x, p.z), time);
+    p.x = r.x;
+    p.z = r.y;
+    r = rotation2D(vec2(p.z, p.y), time);
+    p.z = r.x;
+    p.y = r.y;
+
+    return fminf(pos.y, SDF_Box(p, vec3(0.1f)));
+}
+
+vec4 map2(const Point& pos, float /* time */) {
+    Point p;
+
+    const float repetition = 12.0f;
+    const float radius = 2.0f;
+    const Vector translation = 5.5f * Vector(radius, 0.0f, radius);
+
+    p = pos + translation;
+    p = mod(p, repetition) - 0.25f * repetition;
+    float cylinder = SDF_Cylinder(p, vec3(radius));
+
+    p = mod(Point(pos.z, pos.x, pos.y) + translation, repetition) - 0.25f * repetition;
+    cylinder = smin(cylinder, SDF_Cylinder(p, vec3(radius)), 0.1f);
+
+    p = mod(Point(pos.y, pos.z, pos.x) + translation, repetition) - 0.25f * repetition;
+    cylinder = smin(cylinder, SDF_Cylinder(p, vec3(radius)), 0.1f);
+
+    p = mod(pos, repetition) - 0.5f * repetition;
+    const float cube = -SDF_RoundBox(p, vec3(4.0f), 1.0f);
+
+    return sDifferenceSDF(shape(Color(0.25f, 0.5f, 0.4f), cube),
+                          shape(Color(0.25f, 0.8f, 0.4f), cylinder),
+                          0.5f);
+}
+
+float map2Distance(const Point& pos, float /* time */) {
+    Point p;
+
+    const float repetition = 12.0f;
+    const float radius = 2.0f;
+    const Vector translation = 5.5f * Vector(radius, 0.0f, radius);
+
+    p = mod(pos + translation, repetition) - 0.25f * repetition;
+    float cylinder = SDF_Cylinder(p, vec3(radius));
+
+    p = mod(Point(pos.z, pos.x, pos.y) + translation, repetition) - 0.25f * repetition;
+    cylinder = smin(cylinder, SDF_Cylinder(p, vec3(radius)), 0.1f);
+
+    p = mod(Point(pos.y, pos.z, pos.x) + translation, repetition) - 0.25f * repetition;
+    cylinder = smin(cylinder, SDF_Cylinder(p, vec3(radius)), 0.1f);
+
+    p = mod(pos, repetition) - 0.5f * repetition;
+    const float cube = -SDF_RoundBox(p, vec3(4.0f), 1.0f);
+
+    return smax(cube, -cylinder, 0.5f);
+}
+
+vec4 map3(const Point& pos, float time) {
+    Point p = pos;
+
+    p.x += time;
+    p.z += time;
+    vec2 r = rotation2D(vec2(p.x, p.y), radians(90.0f));
+    p.x = r.x;
+    p.y = r.y;
+    p.y = mod(p.y, 2.0f) - 0.5f;
+    p.z = mod(p.z, 2.0f) - 0.5f;
+    float cylinder = SDF_Cylinder(p, vec3(0.5f));
+
+    p = pos;
+    r = rotation2D(vec2(p.z, p.y), radians(90.0f));
+    p.z = r.x;
+    p.y = r.y;
+    p.x = mod(p.x, 2.0f) - 0.5f;
+    p.y = mod(p.y, 2.0f) - 0.5f;
+    cylinder = smin(cylinder, SDF_Cylinder(p, vec3(0.5f)), 0.2f);
+
+    const float ground = SDF_Plane(pos, Vector(0.0f, 1.0f, 0.0f), 0.5f + 0.5f * sinf(time));
+
+    return sDifferenceSDF(shape(Color(0.75f, 0.3f, 0.6f), ground),
+                          shape(Color(0.9f, 0.45f, 0.75f), cylinder),
+                          0.5f);
+}
+
+float map3Distance(const Point& pos, float time) {
+    Point p = pos;
+
+    p.x += time;
+    p.z += time;
+    vec2 r = rotation2D(vec2(p.x, p.y), radians(90.0f));
+    p.x = r.x;
+    p.y = r.y;
+    p.y = mod(p.y, 2.0f) - 0.5f;
+    p.z = mod(p.z, 2.0f) - 0.5f;
+    float cylinder = SDF_Cylinder(p, vec3(0.5f));
+
+    p = pos;
+    r = rotation2D(vec2(p.z, p.y), radians(90.0f));
+    p.z = r.x;
+    p.y = r.y;
+    p.x = mod(p.x, 2.0f) - 0.5f;
+    p.y = mod(p.y, 2.0f) - 0.5f;
+    cylinder = smin(cylinder, SDF_Cylinder(p, vec3(0.5f)), 0.2f);
+
+    const float ground = SDF_Plane(pos, Vector(0.0f, 1.0f, 0.0f), 0.5f + 0.5f * sinf(time));
+
+    return smax(ground, -cylinder, 0.5f);
+}
+
+vec4 map4(const Point& pos, float /* time */) {
+    Point p;
+
+    vec4 box(RED.x, RED.y, RED.z, 0.0f);
+    vec4 beams(BLUE.x, BLUE.y, BLUE.z, 0.0f);
+
+    const float distance = 8.0f;
+    const float smoothing = 1.0f;
+    const float radius = 3.75f; // Bounding sphere of a group, the reach of the smooth unions included
+
+    vec4 result;
+
+    p = pos - Vector(distance, -2.0f * -distance, 0.0f);
+    box.w = SDF_Box(p, vec3(2.0f));
+    result = box;
+
+    p = pos - Vector(-distance, -2.0f * -distance, 0.0f);
+    if(!isCulled(SDF_Sphere(p, radius), result.w)) {
+        beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
+        beams.w = fminf(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
+        beams.w = fminf(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = unionSDF(result, beams);
+    }
+
+    p = pos - Vector(-distance, 0.0f, 0.0f);
+    if(!isCulled(SDF_Sphere(p, radius), result.w)) {
+        box.w = SDF_Box(p, vec3(2.0f));
+        beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
+        beams.w = fminf(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
+        beams.w = fminf(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = unionSDF(result, unionSDF(box, beams));
+    }
+
+    p = pos;
+    if(!isCulled(SDF_Sphere(p, radius), result.w)) {
+        box.w = SDF_Box(p, vec3(2.0f));
+        beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
+        beams.w = fminf(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
+        beams.w = fminf(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = unionSDF(result, intersectSDF(box, beams));
+    }
+
+    p = pos - Vector(distance, 0.0f, 0.0f);
+    if(!isCulled(SDF_Sphere(p, radius), result.w)) {
+        box.w = SDF_Box(p, vec3(2.0f));
+        beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
+        beams.w = fminf(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
+        beams.w = fminf(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = unionSDF(result, differenceSDF(box, beams));
+    }
+
+    p = pos - Vector(-distance, distance, 0.0f);
+    if(!isCulled(SDF_Sphere(p, radius), result.w)) {
+        box.w = SDF_Box(p, vec3(2.0f));
+        beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
+        beams.w = fminf(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
+        beams.w = fminf(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = unionSDF(result, sUnionSDF(box, beams, smoothing));
+    }
+
+    p = pos - Vector(0.0f, distance, 0.0f);
+    if(!isCulled(SDF_Sphere(p, radius), result.w)) {
+        box.w = SDF_Box(p, vec3(2.0f));
+        beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
+        beams.w = fminf(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
+        beams.w = fminf(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = unionSDF(result, sIntersectSDF(box, beams, smoothing));
+    }
+
+    p = pos - Vector(distance, distance, 0.0f);
+    if(!isCulled(SDF_Sphere(p, radius), result.w)) {
+        box.w = SDF_Box(p, vec3(2.0f));
+        beams.w = SDF_Box(p, vec3(1.0f, 3.0f, 1.0f));
+        beams.w = fminf(beams.w, SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)));
+        beams.w = fminf(beams.w, SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = unionSDF(result, sDifferenceSDF(box, beams, smoothing));
+    }
+
+    return result;
+}
+
+float map4Distance(const Point& pos, float /* time */) {
+    Point p;
+
+    const float distance = 8.0f;
+    const float smoothing = 1.0f;
+    const float radius = 3.75f; // Bounding sphere of a group, see map4
+
+    float box, beams;
+
+    p = pos - Vector(distance, -2.0f * -distance, 0.0f);
+    float result = SDF_Box(p, vec3(2.0f));
+
+    p = pos - Vector(-distance, -2.0f * -distance, 0.0f);
+    if(!isCulled(SDF_Sphere(p, radius), result)) {
+        beams = min3(SDF_Box(p, vec3(1.0f, 3.0f, 1.0f)), SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)),
+                     SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = fminf(result, beams);
+    }
+
+    p = pos - Vector(-distance, 0.0f, 0.0f);
+    if(!isCulled(SDF_Sphere(p, radius), result)) {
+        box = SDF_Box(p, vec3(2.0f));
+        beams = min3(SDF_Box(p, vec3(1.0f, 3.0f, 1.0f)), SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)),
+                     SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = fminf(result, fminf(box, beams));
+    }
+
+    p = pos;
+    if(!isCulled(SDF_Sphere(p, radius), result)) {
+        box = SDF_Box(p, vec3(2.0f));
+        beams = min3(SDF_Box(p, vec3(1.0f, 3.0f, 1.0f)), SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)),
+                     SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = fminf(result, fmaxf(box, beams));
+    }
+
+    p = pos - Vector(distance, 0.0f, 0.0f);
+    if(!isCulled(SDF_Sphere(p, radius), result)) {
+        box = SDF_Box(p, vec3(2.0f));
+        beams = min3(SDF_Box(p, vec3(1.0f, 3.0f, 1.0f)), SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)),
+                     SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = fminf(result, fmaxf(box, -beams));
+    }
+
+    p = pos - Vector(-distance, distance, 0.0f);
+    if(!isCulled(SDF_Sphere(p, radius), result)) {
+        box = SDF_Box(p, vec3(2.0f));
+        beams = min3(SDF_Box(p, vec3(1.0f, 3.0f, 1.0f)), SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)),
+                     SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = fminf(result, smin(box, beams, smoothing));
+    }
+
+    p = pos - Vector(0.0f, distance, 0.0f);
+    if(!isCulled(SDF_Sphere(p, radius), result)) {
+        box = SDF_Box(p, vec3(2.0f));
+        beams = min3(SDF_Box(p, vec3(1.0f, 3.0f, 1.0f)), SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)),
+                     SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = fminf(result, smax(box, beams, smoothing));
+    }
+
+    p = pos - Vector(distance, distance, 0.0f);
+    if(!isCulled(SDF_Sphere(p, radius), result)) {
+        box = SDF_Box(p, vec3(2.0f));
+        beams = min3(SDF_Box(p, vec3(1.0f, 3.0f, 1.0f)), SDF_Box(p, vec3(3.0f, 1.0f, 1.0f)),
+                     SDF_Box(p, vec3(1.0f, 1.0f, 3.0f)));
+        result = fminf(result, smax(box, -beams, smoothing));
+    }
+
+    return result;
+}
+
+vec4 map5(const Point& pos, float /* time */) {
+    return shape(Color(1.0f), SDF_Plane(pos, Vector(0.0f, 1.0f, 0.0f), 1.0f));
+}
+
+float map5Distance(const Point& pos, float /* time */) {
+    return SDF_Plane(pos, Vector(0.0f, 1.0f, 0.0f), 1.0f);
+}
+
+vec4 map6(const Point& pos, float /* time */) {
+    const float l = 1.0f, s = 4.0f;
+    const Point p = pos - s * clamp(round(pos / s), -l, l);
+
+    const float cube = SDF_Sphere(p, 1.0f);
+
+    const vec3 dim(0.4f, 1.5f, 0.4f);
+    const float cross = min3(SDF_Box(p, dim),
+                             SDF_Box(p, vec3(dim.y, dim.z, dim.x)),
+                             SDF_Box(p, vec3(dim.z, dim.x, dim.y)));
+
+    return differenceSDF(shape(Color(0.1f, 0.3f, 0.5f), cube), shape(Color(0.8f), cross));
+}
+
+float map6Distance(const Point& pos, float /* time */) {
+    const float l = 1.0f, s = 4.0f;
+    const Point p = pos - s * clamp(round(pos / s), -l, l);
+
+    const float cube = SDF_Sphere(p, 1.0f);
+
+    const vec3 dim(0.4f, 1.5f, 0.4f);
+    const float cross = min3(SDF_Box(p, dim),
+                             SDF_Box(p, vec3(dim.y, dim.z, dim.x)),
+                             SDF_Box(p, vec3(dim.z, dim.x, dim.y)));
+
+    return fmaxf(cube, -cross);
+}
+
+vec4 map7(const Point& pos, float time) {
+    Point p = pos;
+    const vec4 ground = shape(RED, SDF_Plane(p, GREEN, 0.5f + 0.5f * sinf(time)));
+
+    p = pos;
+    p.y += 0.5f;
+    const vec2 r = rotation2D(vec2(p.x, p.y), radians(90.0f));
+    p.x = r.x;
+    p.y = r.y;
+    p.y = mod(p.y, 2.0f) - 1.0f;
+    p.z = mod(p.z, 2.0f) - 1.0f;
+    const vec4 cube = shape(Color(0.851f, 0.584f, 0.251f), SDF_Box(p, vec3(0.5f)));
+
+    p = pos;
+    p.y -= time;
+    p.x = mod(p.x, 2.0f) - 1.0f;
+    p.z = mod(p.z, 2.0f) - 1.0f;
+    p.y = mod(p.y, 4.0f) - 2.0f;
+    const vec4 sphere = shape(Color(0.851f, 0.251f, 0.682f), SDF_Sphere(p, 0.25f));
+
+    p = pos;
+    const vec4 ceiling = shape(Color(0.0f), SDF_Plane(p, Vector(0.0f, -1.0f, 0.0f), 4.0f));
+
+    return sUnionSDF(sDifferenceSDF(ground, cube, 0.25f), differenceSDF(sphere, ceiling), 0.25f);
+}
+
+float map7Distance(const Point& pos, float time) {
+    Point p = pos;
+    const float ground = SDF_Plane(p, GREEN, 0.5f + 0.5f * sinf(time));
+
+    p = pos;
+    p.y += 0.5f;
+    const vec2 r = rotation2D(vec2(p.x, p.y), radians(90.0f));
+    p.x = r.x;
+    p.y = r.y;
+    p.y = mod(p.y, 2.0f) - 1.0f;
+    p.z = mod(p.z, 2.0f) - 1.0f;
+    const float cube = SDF_Box(p, vec3(0.5f));
+
+    p = pos;
+    p.y -= time;
+    p.x = mod(p.x, 2.0f) - 1.0f;
+    p.z = mod(p.z, 2.0f) - 1.0f;
+    p.y = mod(p.y, 4.0f) - 2.0f;
+    const float sphere = SDF_Sphere(p, 0.25f);
+
+    const float ceiling = SDF_Plane(pos, Vector(0.0f, -1.0f, 0.0f), 4.0f);
+
+    return smin(smax(ground, -cube, 0.25f), fmaxf(sphere, -ceiling), 0.25f);
+}
+
+vec4 map8(const Point& pos, float /* time */) {
+    Point p = pos;
+
+    const vec4 ground(0.545f, 0.851f, 0.42f, p.y);
+    vec4 result = ground;
+
+    // The outer walls of the house bound everything else
+    p = pos;
+    p.y -= 5.0f;
+    float house = SDF_Box(p, vec3(5.0f));
+
+    if(isCulled(house, result.w)) {
+        return result;
+    }
+
+    p = pos;
+    p.y -= 4.05f;
+    house = fmaxf(house, -SDF_Box(p, vec3(4.0f)));
+
+    p = pos - Vector(0.0f, 3.05f, 5.0f);
+    house = fmaxf(house, -SDF_Box(p, vec3(2.0f, 3.0f, 2.0f)));
+
+    result = unionSDF(result, shape(Color(0.6f, 0.565f, 0.506f), house));
+
+    p = pos - Vector(0.0f, 3.5f, 0.0f);
+    if(isCulled(SDF_Sphere(p, 3.6f), result.w)) {
+        return result;
+    }
+
+    p = pos;
+    p.y -= 1.5f;
+    float snowman = SDF_Sphere(p, 1.5f);
+
+    p.y -= 2.25f;
+    snowman = smin(snowman, SDF_Sphere(p, 1.0f), 0.15f);
+
+    p.y -= 1.5f;
+    snowman = smin(snowman, SDF_Sphere(p, 0.6f), 0.15f);
+
+    float eyes = SDF_Sphere(pos - Vector(0.3f, 5.4f, 0.5f), 0.05f);
+    eyes = fminf(eyes, SDF_Sphere(pos - Vector(-0.3f, 5.4f, 0.5f), 0.05f));
+
+    p = pos - Vector(0.0f, 5.25f, 1.1f);
+    const vec2 r = rotation2D(vec2(p.z, p.y), radians(90.0f));
+    p.z = r.x;
+    p.y = r.y;
+    const float nose = SDF_Cone(p, vec2(sinf(radians(7.5f)), cosf(radians(7.5f))), 0.5f);
+
+    result = unionSDF(result, sUnionSDF(shape(Color(1.0f), snowman),
+                                        unionSDF(shape(Color(0.0f), eyes),
+                                                 shape(Color(0.871f, 0.584f, 0.184f), nose)),
+                                        0.01f));
+
+    return result;
+}
+
+float map8Distance(const Point& pos, float /* time */) {
+    Point p = pos;
+
+    float result = p.y;
+
+    p = pos;
+    p.y -= 5.0f;
+    float house = SDF_Box(p, vec3(5.0f));
+
+    if(isCulled(house, result)) {
+        return result;
+    }
+
+    p = pos;
+    p.y -= 4.05f;
+    house = fmaxf(house, -SDF_Box(p, vec3(4.0f)));
+
+    p = pos - Vector(0.0f, 3.05f, 5.0f);
+    house = fmaxf(house, -SDF_Box(p, vec3(2.0f, 3.0f, 2.0f)));
+
+    result = fminf(result, house);
+
+    p = pos - Vector(0.0f, 3.5f, 0.0f);
+    if(isCulled(SDF_Sphere(p, 3.6f), result)) {
+        return result;
+    }
+
+    p = pos;
+    p.y -= 1.5f;
+    float snowman = SDF_Sphere(p, 1.5f);
+
+    p.y -= 2.25f;
+    snowman = smin(snowman, SDF_Sphere(p, 1.0f), 0.15f);
+
+    p.y -= 1.5f;
+    snowman = smin(snowman, SDF_Sphere(p, 0.6f), 0.15f);
+
+    const float eyes = fminf(SDF_Sphere(pos - Vector(0.3f, 5.4f, 0.5f), 0.05f),
+                             SDF_Sphere(pos - Vector(-0.3f, 5.4f, 0.5f), 0.05f));
+
+    p = pos - Vector(0.0f, 5.25f, 1.1f);
+    const vec2 r = rotation2D(vec2(p.z, p.y), radians(90.0f));
+    p.z = r.x;
+    p.y = r.y;
+    const float nose = SDF_Cone(p, vec2(sinf(radians(7.5f)), cosf(radians(7.5f))), 0.5f);
+
+    return fminf(result, smin(snowman, fminf(eyes, nose), 0.01f));
+}
+
+vec4 map9(const Point& pos, float time) {
+    Point p = pos;
+    const vec4 ground(1.0f, 1.0f, 1.0f, p.y + 1.0f);
+
+    p = pos;
+    const vec4 sphere = shape(Color(1.0f), SDF_Sphere(p, 1.5f));
+
+    p = pos;
+    p.y -= 1.0f + sinf(time);
+    vec4 cube = shape(RED, SDF_RoundBox(p, vec3(1.0f), 0.1f));
+
+    p = pos;
+    p.x -= 1.0f + sinf(time);
+    const vec4 cube2 = shape(GREEN, SDF_RoundBox(p, vec3(1.0f), 0.1f));
+
+    p = pos;
+    p.x += 1.0f + sinf(time);
+    const vec4 cube3 = shape(BLUE, SDF_RoundBox(p, vec3(1.0f), 0.1f));
+
+    cube = sUnionSDF(cube, sUnionSDF(cube2, cube3, 0.5f), 0.5f);
+
+    return unionSDF(ground, sUnionSDF(sphere, cube, 0.5f));
+}
+
+float map9Distance(const Point& pos, float time) {
+    Point p = pos;
+    const float ground = p.y + 1.0f;
+
+    const float sphere = SDF_Sphere(pos, 1.5f);
+
+    p = pos;
+    p.y -= 1.0f + sinf(time);
+    float cube = SDF_RoundBox(p, vec3(1.0f), 0.1f);
+
+    p = pos;
+    p.x -= 1.0f + sinf(time);
+    const float cube2 = SDF_RoundBox(p, vec3(1.0f), 0.1f);
+
+    p = pos;
+    p.x += 1.0f + sinf(time);
+    const float cube3 = SDF_RoundBox(p, vec3(1.0f), 0.1f);
+
+    cube = smin(cube, smin(cube2, cube3, 0.5f), 0.5f);
+
+    return fminf(ground, smin(sphere, cube, 0.5f));
+}
+
+vec4 map10(const Point& pos, float time) {
+    const Point p = pos;
+
+    const vec4 ground = shape(checker(p, Color(0.89f, 0.847f, 0.471f), Color(0.89f, 0.337f, 0.306f)),
+                              p.y + 10.0f);
+
+    const vec3 factor = time * vec3(2.0f, 0.5f, 3.0f);
+    const float displacement = sinf(p.x + factor.x) * sinf(p.y + factor.y) * sinf(p.z + factor.z);
+    const vec4 sphere = shape(mix(BLUE, GREEN, 0.5f + 0.5f * displacement),
+                              SDF_Sphere(p, 10.0f + displacement));
+
+    return unionSDF(ground, sphere);
+}
+
+float map10Distance(const Point& pos, float time) {
+    const Point p = pos;
+
+    const vec3 factor = time * vec3(2.0f, 0.5f, 3.0f);
+    const float displacement = sinf(p.x + factor.x) * sinf(p.y + factor.y) * sinf(p.z + factor.z);
+
+    return fminf(p.y + 10.0f, SDF_Sphere(p, 10.0f + displacement));
+}
+
+vec4 map11(const Point& pos, float time) {
+    const float R = 50.0f;
+
+    // Distances to the circles of the tori, their tubes being added once the radius is known
+    const float circleX = SDF_Torus(pos - Vector(-R / 2.0f, 0.0f, 0.0f), R, 0.0f);
+    const float circleY = SDF_Torus(pos - Vector(R / 2.0f, 0.0f, 0.0f), R, 0.0f);
+    const float circleZ = SDF_Torus(Point(pos.x, pos.z, pos.y), R, 0.0f);
+
+    // The displacement keeps the tubes' radius under 3 and the smooth unions reach 0.25 further.
+    // Nothing else is in the scene so the tori are only evaluated within 1 of that bound.
+    const float bound = min3(circleX, circleY, circleZ) - 3.25f;
+    if(isCulled(bound, 1.0f)) {
+        return shape(BLUE, bound);
+    }
+
+    const Point p = pos;
+
+    const float displacement = sinf(p.x + 2.0f * time)
+                               * sinf(p.y + sinf(0.25f * time))
+                               * sinf(p.z + 3.0f * time);
+    const float r = 2.0f + displacement;
+
+    vec4 torus = shape(mix(BLUE, GREEN, 0.5f + 0.5f * displacement), circleX - r);
+    torus = sUnionSDF(torus, vec4(torus.y, torus.x, torus.z, circleY - r), 0.5f);
+    torus = sUnionSDF(torus, vec4(torus.x, torus.y, torus.z, circleZ - r), 0.5f);
+
+    return torus;
+}
+
+float map11Distance(const Point& pos, float time) {
+    const float R = 50.0f;
+
+    const float circleX = SDF_Torus(pos - Vector(-R / 2.0f, 0.0f, 0.0f), R, 0.0f);
+    const float circleY = SDF_Torus(pos - Vector(R / 2.0f, 0.0f, 0.0f), R, 0.0f);
+    const float circleZ = SDF_Torus(Point(pos.x, pos.z, pos.y), R, 0.0f);
+
+    // See map11
+    const float bound = min3(circleX, circleY, circleZ) - 3.25f;
+    if(isCulled(bound, 1.0f)) {
+        return bound;
+    }
+
+    const Point p = pos;
+
+    const float displacement = sinf(p.x + 2.0f * time)
+                               * sinf(p.y + sinf(0.25f * time))
+                               * sinf(p.z + 3.0f * time);
+    const float r = 2.0f + displacement;
+
+    return smin(smin(circleX - r, circleY - r, 0.5f), circleZ - r, 0.5f);
+}
+
+vec4 map12(const Point& pos, float /* time */) {
+    Point p = pos;
+
+    p.y += 1.0f;
+    const float check = floorf(pos.x / 2.0f) + floorf(pos.y / 2.0f) + floorf(pos.z / 2.0f);
+    const Color color = mod(check, 2.0f) == 0.0f ? Color(0.89f, 0.816f, 0.702f)
+                                                 : Color(0.188f, 0.173f, 0.145f);
+
+    return shape(color, SDF_Box(p, vec3(8.0f, 1.0f, 8.0f)));
+}
+
+float map12Distance(const Point& pos, float /* time */) {
+    Point p = pos;
+    p.y += 1.0f;
+
+    return SDF_Box(p, vec3(8.0f, 1.0f, 8.0f));
+}
@@ -0,0 +1,124 @@
+/***************************************************************************************************
+ * @file  raymarching.cpp
+ * @brief Implementation of the raymarching functions of shaders/raymarching.glsl
+ **************************************************************************************************/
+
+#include "cpu/raymarching.hpp"
+
+#include <cmath>
+#include "cpu/maps.hpp"
+
+bool hasShadows(unsigned int scene) {
+    switch(scene) {
+        case 0u:
+        case 1u:
+        case 3u:
+        case 5u:
+            return false;
+        default:
+            return scene < SCENE_COUNT; // Unknown scenes fall back to map1
+    }
+}
+
+vec4 map(const Point& pos, const Uniforms& uniforms) {
+    switch(uniforms.active_scene) {
+        case 0u: return map1(pos, uniforms.time);
+        case 1u: return map2(pos, uniforms.time);
+        case 2u: return map3(pos, uniforms.time);
+        case 3u: return map4(pos, uniforms.time);
+        case 4u: return map5(pos, uniforms.time);
+        case 5u: return map6(pos, uniforms.time);
+        case 6u: return map7(pos, uniforms.time);
+        case 7u: return map8(pos, uniforms.time);
+        case 8u: return map9(pos, uniforms.time);
+        case 9u: return map10(pos, uniforms.time);
+        case 10u: return map11(pos, uniforms.time);
+        case 11u: return map12(pos, uniforms.time);
+        default: return map1(pos, uniforms.time);
+    }
+}
+
+float mapDistance(const Point& pos, const Uniforms& uniforms) {
+    switch(uniforms.active_scene) {
+        case 0u: return map1Distance(pos, uniforms.time);
+        case 1u: return map2Distance(pos, uniforms.time);
+        case 2u: return map3Distance(pos, uniforms.time);
+        case 3u: return map4Distance(pos, uniforms.time);
+        case 4u: return map5Distance(pos, uniforms.time);
+        case 5u: return map6Distance(pos, uniforms.time);
+        case 6u: return map7Distance(pos, uniforms.time);
+        case 7u: return map8Distance(pos, uniforms.time);
+        case 8u: return map9Distance(pos, uniforms.time);
+        case 9u: return map10Distance(pos, uniforms.time);
+        case 10u: return map11Distance(pos, uniforms.time);
+        case 11u: return map12Distance(pos, uniforms.time);
+        default: return map1Distance(pos, uniforms.time);
+    }
+}
+
+float getRelaxation(const Uniforms& uniforms) {
+    if(!uniforms.isRelaxed) {
+        return 1.0f;
+    }
+
+    return uniforms.active_scene < SCENE_COUNT ? RELAXATION[uniforms.active_scene] : 1.0f;
+}
+
+unsigned int getStepBudget(const Uniforms& uniforms) {
+    if(!uniforms.isHitAdaptive) {
+        return MAX_STEPS;
+    }
+
+    return uniforms.active_scene < SCENE_COUNT ? STEP_BUDGET[uniforms.active_scene] : MAX_STEPS;
+}
+
+float getHitDistance(float distanceFromOrigin, const Uniforms& uniforms) {
+    if(!uniforms.isHitAdaptive) {
+        return MIN_DISTANCE;
+    }
+
+    // A pixel is 2 / resolution.y wide at a distance of 1 along the ray
+    const float footprint = 2.0f * distanceFromOrigin / uniforms.resolution.y;
+    return fmaxf(MIN_DISTANCE, HIT_FOOTPRINT * footprint);
+}
+
+float raymarch(const Ray& ray, const Uniforms& uniforms, Color& color, unsigned int& steps) {
+    const unsigned int stepBudget = getStepBudget(uniforms);
+    float relaxation = getRelaxation(uniforms);
+
+    vec4 distance;
+    float distanceFromOrigin = 0.0f;
+    float previousRadius = 0.0f;
+    float stepLength = 0.0f;
+
+    for(steps = 0u ; steps < stepBudget ;) {
+        distance = map(ray.origin + ray.direction * distanceFromOrigin, uniforms);
+        ++steps;
+
+        const float radius = fabsf(distance.w);
+
+        if(relaxation > 1.0f && radius + previousRadius < stepLength) {
+            distanceFromOrigin -= stepLength - stepLength / relaxation;
+            relaxation = 1.0f;
+            continue;
+        }
+
+        stepLength = relaxation * distance.w;
+        previousRadius = radius;
+        distanceFromOrigin += stepLength;
+
+        if(radius < getHitDistance(distanceFromOrigin, uniforms)
+           || distanceFromOrigin >= MAX_DISTANCE) {
+            color = Color(distance.x, distance.y, distance.z);
+            return distanceFromOrigin;
+        }
+    }
+
+    // Rays that run out of steps haven't found a surface
+    return MAX_DISTANCE;
+}
+
+float raymarch(const Ray& ray, const Uniforms& uniforms, Color& color) {
+    unsigned int steps;
+    return raymarch(ray, uniforms, color, steps);
+}
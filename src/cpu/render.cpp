@@ -0,0 +1,153 @@
+/***************************************************************************************************
+ * @file  render.cpp
+ * @brief Implementation of the rendering functions of shaders/render.glsl and anti_aliasing.glsl
+ **************************************************************************************************/
+
+#include "cpu/render.hpp"
+
+#include <cmath>
+#include <vector>
+
+#include "cpu/lighting.hpp"
+#include "maths/common.hpp"
+#include "maths/geometry.hpp"
+
+static const Color BACKGROUND(0.125f, 0.5f, 0.8f);
+
+/**
+ * @brief The sub-pixel offsets of the samples of renderAntiAliasing4, in a rotated grid.
+ */
+static const vec2 ANTI_ALIASING_OFFSETS[ANTI_ALIASING_SAMPLE_COUNT] {
+    vec2(0.125f, 0.375f), vec2(-0.125f, -0.375f), vec2(-0.375f, 0.125f), vec2(0.375f, -0.125f)
+};
+
+vec2 getUV(const vec2& fragCoord, const vec2& offset, const Uniforms& uniforms) {
+    return (2.0f * (fragCoord + offset) - uniforms.resolution) / uniforms.resolution.y;
+}
+
+Ray getRay(const vec2& fragCoord, const vec2& uvOffset, const Uniforms& uniforms) {
+    const vec2 uv = getUV(fragCoord, uvOffset, uniforms);
+    return Ray{
+        uniforms.cameraPos,
+        normalize(uniforms.cameraFront + uv.x * uniforms.cameraRight + uv.y * uniforms.cameraUp)
+    };
+}
+
+vec2 getAntiAliasingOffset(unsigned int sample) {
+    return ANTI_ALIASING_OFFSETS[sample % ANTI_ALIASING_SAMPLE_COUNT];
+}
+
+Color render(const vec2& fragCoord, const vec2& uvOffset, const Uniforms& uniforms,
+             vec4& geometry) {
+    Color color = BACKGROUND;
+
+    const Ray ray = getRay(fragCoord, uvOffset, uniforms);
+    const float distance = raymarch(ray, uniforms, color);
+
+    return shade(ray, distance, color, uniforms, geometry);
+}
+
+Color shade(const Ray& ray, float distance, const Color& surfaceColor, const Uniforms& uniforms,
+            vec4& geometry) {
+    Color color = surfaceColor;
+    geometry = vec4(0.0f, 0.0f, 0.0f, distance);
+
+    if(distance < MAX_DISTANCE) {
+        if(uniforms.hasLighting) {
+            const Point pos = ray.origin + ray.direction * distance;
+            const Vector normal = getNormal(pos, uniforms);
+            geometry = vec4(normal.x, normal.y, normal.z, distance);
+
+            color *= phongLighting(ray, pos, normal, uniforms);
+            color = mix(BACKGROUND, color, expf(-0.00002f * distance * distance)); // fog
+        } else {
+            color *= Color(0.15f * distance);
+        }
+    } else {
+        color = BACKGROUND + fmaxf(0.75f * ray.direction.y, 0.0f);
+    }
+
+    return color;
+}
+
+Color render(const vec2& fragCoord, const vec2& uvOffset, const Uniforms& uniforms) {
+    vec4 geometry;
+    return render(fragCoord, uvOffset, uniforms, geometry);
+}
+
+Color renderAntiAliasing4(const vec2& fragCoord, const Uniforms& uniforms) {
+    return 0.25f * (render(fragCoord, ANTI_ALIASING_OFFSETS[0], uniforms)
+                    + render(fragCoord, ANTI_ALIASING_OFFSETS[1], uniforms)
+                    + render(fragCoord, ANTI_ALIASING_OFFSETS[2], uniforms)
+                    + render(fragCoord, ANTI_ALIASING_OFFSETS[3], uniforms));
+}
+
+void renderRays(const Ray* rays, unsigned int count, const Uniforms& uniforms, SIMDLevel level,
+                Color* colors, vec4* geometry) {
+    std::vector<float> distances(count);
+    std::vector<unsigned int> steps(count);
+
+    for(unsigned int i = 0u ; i < count ; ++i) {
+        colors[i] = BACKGROUND;
+    }
+
+    raymarchPacket(rays, count, uniforms, level, distances.data(), colors, steps.data());
+
+    for(unsigned int i = 0u ; i < count ; ++i) {
+        colors[i] = shade(rays[i], distances[i], colors[i], uniforms, geometry[i]);
+    }
+}
+
+/**
+ * @brief Calculates the perceived brightness of a color.
+ * @param color The color.
+ * @return The luminance of the color.
+ */
+static float luminance(const Color& color) {
+    return dot(color, Color(0.299f, 0.587f, 0.114f));
+}
+
+/**
+ * @brief Calculates the inverse of the distance of a sample, the same for every miss.
+ * @param distance The distance the ray travelled, which is negative if it started inside a
+ * surface and may overshoot MAX_DISTANCE.
+ * @return The inverse distance.
+ */
+static float getInverseDistance(float distance) {
+    return 1.0f / clamp(distance, MIN_DISTANCE, MAX_DISTANCE);
+}
+
+/**
+ * @brief Whether the angle between two normals is large enough to be an edge.
+ * @param normal The first normal, zero if it wasn't calculated.
+ * @param neighbor The second normal, zero if it wasn't calculated.
+ * @return Whether both normals were calculated and form a crease.
+ */
+static bool isNormalDiscontinuous(const vec4& normal, const vec4& neighbor) {
+    const Vector a(normal.x, normal.y, normal.z);
+    const Vector b(neighbor.x, neighbor.y, neighbor.z);
+
+    return dot(a, a) > 0.0f && dot(b, b) > 0.0f && dot(a, b) < EDGE_NORMAL_THRESHOLD;
+}
+
+bool isEdge(const Color& color, const vec4& geometry,
+            const Color& colorA, const vec4& geometryA,
+            const Color& colorB, const vec4& geometryB) {
+
+    // The inverse distance varies smoothly across a plane, so wide floors aren't flagged while
+    // silhouettes, where it jumps, are
+    const float inverse = getInverseDistance(geometry.w);
+    const float curvature = fabsf(getInverseDistance(geometryA.w) + getInverseDistance(geometryB.w)
+                                  - 2.0f * inverse);
+    if(curvature > EDGE_DEPTH_THRESHOLD * inverse) {
+        return true;
+    }
+
+    if(isNormalDiscontinuous(geometry, geometryA) || isNormalDiscontinuous(geometry, geometryB)) {
+        return true;
+    }
+
+    const float center = luminance(color);
+    return fmaxf(fabsf(luminance(colorA) - center), fabsf(luminance(colorB) - center))
+           > EDGE_COLOR_THRESHOLD;
+}
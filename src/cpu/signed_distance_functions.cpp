@@ -0,0 +1,55 @@
+/***************************************************************************************************
+ * @file  signed_distance_functions.cpp
+ * @brief Implementation of the signed distance functions of shaders/signed_distance_functions.glsl
+ **************************************************************************************************/
+
+#include "cpu/signed_distance_functions.hpp"
+
+#include <cmath>
+#include "maths/common.hpp"
+#include "maths/geometry.hpp"
+
+float SDF_Plane(const Point& pos, const Vector& normal, float height) {
+    return dot(pos, normalize(normal)) + height;
+}
+
+float SDF_Box(const Point& pos, const vec3& dimensions) {
+    const vec3 q = abs(pos) - dimensions;
+    return length(max(q, 0.0f)) + fminf(fmaxf(q.x, fmaxf(q.y, q.z)), 0.0f);
+}
+
+float SDF_RoundBox(const Point& pos, const vec3& dimensions, float radius) {
+    const vec3 q = abs(pos) - dimensions + radius;
+    return length(max(q, 0.0f)) + fminf(fmaxf(q.x, fmaxf(q.y, q.z)), 0.0f) - radius;
+}
+
+float SDF_Sphere(const Point& pos, float radius) {
+    return length(pos) - radius;
+}
+
+float SDF_Cylinder(const Point& pos, const vec3& c) {
+    return length(vec2(pos.x - c.x, pos.z - c.y)) - c.z;
+}
+
+float SDF_CappedCylinder(const Point& pos, float height, float radius) {
+    const vec2 d = abs(vec2(length(vec2(pos.x, pos.z)), pos.y)) - vec2(radius, height);
+    return fminf(fmaxf(d.x, d.y), 0.0f) + length(max(d, 0.0f));
+}
+
+float SDF_Cone(const Point& pos, const vec2& c, float height) {
+    // c is the sin/cos of the angle, h is height
+    const vec2 q = height * vec2(c.x / c.y, -1.0f);
+
+    const vec2 w(length(vec2(pos.x, pos.z)), pos.y);
+    const vec2 a = w - q * clamp(dot(w, q) / dot(q, q), 0.0f, 1.0f);
+    const vec2 b = w - q * vec2(clamp(w.x / q.x, 0.0f, 1.0f), 1.0f);
+    const float k = sign(q.y);
+    const float d = fminf(dot(a, a), dot(b, b));
+    const float s = fmaxf(k * (w.x * q.y - w.y * q.x), k * (w.y - q.y));
+    return sqrtf(d) * sign(s);
+}
+
+float SDF_Torus(const Point& pos, float Radius, float radius) {
+    const vec2 q(length(vec2(pos.x, pos.z)) - Radius, pos.y);
+    return length(q) - radius;
+}
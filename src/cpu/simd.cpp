@@ -0,0 +1,99 @@
+/***************************************************************************************************
+ * @file  simd.cpp
+ * @brief Implementation of the packet ray marching and of the selection of its instruction set
+ **************************************************************************************************/
+
+#include "cpu/simd.hpp"
+
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Whether the packet marchers of the x86 instruction sets are compiled in, see
+ * CMakeLists.txt.
+ */
+#if defined(__x86_64__) || defined(__i386__)
+#define HAS_X86_PACKETS
+#endif
+
+SIMDLevel getSupportedSIMDLevel() {
+#ifdef HAS_X86_PACKETS
+    // Also checks that the operating system saves the wide registers
+    __builtin_cpu_init();
+
+    if(__builtin_cpu_supports("avx512f")) {
+        return SIMDLevel::avx512;
+    } else if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return SIMDLevel::avx2;
+    } else if(__builtin_cpu_supports("sse4.1")) {
+        return SIMDLevel::sse;
+    }
+#endif
+
+    return SIMDLevel::scalar;
+}
+
+std::string getSIMDLevelName(SIMDLevel level) {
+    switch(level) {
+        case SIMDLevel::sse: return "sse";
+        case SIMDLevel::avx2: return "avx2";
+        case SIMDLevel::avx512: return "avx512";
+        default: return "scalar";
+    }
+}
+
+bool parseSIMDLevel(const std::string& name, SIMDLevel& level) {
+    for(unsigned int i = 0u ; i <= static_cast<unsigned int>(SIMDLevel::avx512) ; ++i) {
+        if(name == getSIMDLevelName(static_cast<SIMDLevel>(i))) {
+            level = static_cast<SIMDLevel>(i);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+unsigned int getPacketSize(SIMDLevel level) {
+    switch(level) {
+        case SIMDLevel::sse: return 4u;
+        case SIMDLevel::avx2: return 8u;
+        case SIMDLevel::avx512: return 16u;
+        default: return 1u;
+    }
+}
+
+void raymarchPacket(const Ray* rays, unsigned int count, const Uniforms& uniforms, SIMDLevel level,
+                    float* distances, Color* colors, unsigned int* steps) {
+#ifdef HAS_X86_PACKETS
+    if(level != SIMDLevel::scalar) {
+        std::vector<float> colorDistances(count);
+        std::unique_ptr<bool[]> isStopped(new bool[count]);
+
+        if(level == SIMDLevel::sse) {
+            raymarchPacketSSE(rays, count, uniforms,
+                              distances, colorDistances.data(), isStopped.get(), steps);
+        } else if(level == SIMDLevel::avx2) {
+            raymarchPacketAVX2(rays, count, uniforms,
+                               distances, colorDistances.data(), isStopped.get(), steps);
+        } else {
+            raymarchPacketAVX512(rays, count, uniforms,
+                                 distances, colorDistances.data(), isStopped.get(), steps);
+        }
+
+        // A single scene evaluation per ray gives the colors the packets didn't track
+        for(unsigned int i = 0u ; i < count ; ++i) {
+            if(isStopped[i]) {
+                const vec4 sample = map(rays[i].origin + rays[i].direction * colorDistances[i],
+                                        uniforms);
+                colors[i] = Color(sample.x, sample.y, sample.z);
+            }
+        }
+
+        return;
+    }
+#endif
+
+    for(unsigned int i = 0u ; i < count ; ++i) {
+        distances[i] = raymarch(rays[i], uniforms, colors[i], steps[i]);
+    }
+}
@@ -0,0 +1,20 @@
+/***************************************************************************************************
+ * @file  simd_avx2.cpp
+ * @brief Implementation of the packet marcher for AVX2 and FMA, the only file compiled for it
+ **************************************************************************************************/
+
+#include "cpu/simd.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include "cpu/simd/floatx8.hpp"
+#include "cpu/simd/raymarching.hpp"
+
+void raymarchPacketAVX2(const Ray* rays, unsigned int count, const Uniforms& uniforms,
+                        float* distances, float* colorDistances, bool* isStopped,
+                        unsigned int* steps) {
+    raymarchPackets<floatx8>(rays, count, uniforms, distances, colorDistances, isStopped,
+                             steps);
+}
+
+#endif
@@ -0,0 +1,20 @@
+/***************************************************************************************************
+ * @file  simd_sse.cpp
+ * @brief Implementation of the packet marcher for SSE4.1, the only file compiled for it
+ **************************************************************************************************/
+
+#include "cpu/simd.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include "cpu/simd/floatx4.hpp"
+#include "cpu/simd/raymarching.hpp"
+
+void raymarchPacketSSE(const Ray* rays, unsigned int count, const Uniforms& uniforms,
+                       float* distances, float* colorDistances, bool* isStopped,
+                       unsigned int* steps) {
+    raymarchPackets<floatx4>(rays, count, uniforms, distances, colorDistances, isStopped,
+                             steps);
+}
+
+#endif
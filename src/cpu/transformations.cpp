@@ -0,0 +1,25 @@
+/***************************************************************************************************
+ * @file  transformations.cpp
+ * @brief Implementation of the 3D transformation functions of shaders/transformations.glsl
+ **************************************************************************************************/
+
+#include "cpu/transformations.hpp"
+
+#include <cmath>
+#include "maths/common.hpp"
+#include "maths/geometry.hpp"
+
+vec2 rotation2D(const vec2& vec, float angle) {
+    const float cosine = cosf(angle);
+    const float sine = sinf(angle);
+
+    return vec2(
+        cosine * vec.x - sine * vec.y,
+        sine * vec.x + cosine * vec.y
+    );
+}
+
+Point rotation3D(const Point& point, const Vector& axis, float angle) {
+    // Rodrigues' rotation formula
+    return mix(dot(axis, point) * axis, point, cosf(angle)) + cross(axis, point) * sinf(angle);
+}
@@ -0,0 +1,77 @@
+/***************************************************************************************************
+ * @file  utility.cpp
+ * @brief Implementation of the utility functions of shaders/utility.glsl
+ **************************************************************************************************/
+
+#include "cpu/utility.hpp"
+
+#include <cmath>
+#include "maths/common.hpp"
+
+float smin(float a, float b, float t) {
+    const float h = clamp(0.5f + 0.5f * (a - b) / t, 0.0f, 1.0f);
+    return mix(a, b, h) - t * h * (1.0f - h);
+}
+
+float smax(float a, float b, float t) {
+    const float h = clamp(0.5f - 0.5f * (a - b) / t, 0.0f, 1.0f);
+    return mix(a, b, h) + t * h * (1.0f - h);
+}
+
+float min3(float a, float b, float c) {
+    return fminf(a, fminf(b, c));
+}
+
+float max3(float a, float b, float c) {
+    return fmaxf(a, fmaxf(b, c));
+}
+
+bool isCulled(float bound, float closest) {
+    return bound > closest;
+}
+
+vec4 intersectSDF(const vec4& a, const vec4& b) {
+    return a.w > b.w ? a : b;
+}
+
+vec4 unionSDF(const vec4& a, const vec4& b) {
+    return a.w < b.w ? a : b;
+}
+
+vec4 differenceSDF(const vec4& a, const vec4& b) {
+    return a.w > -b.w ? a : vec4(b.x, b.y, b.z, -b.w);
+}
+
+vec4 sIntersectSDF(const vec4& a, const vec4& b, float t) {
+    const float h = clamp(0.5f - 0.5f * (a.w - b.w) / t, 0.0f, 1.0f);
+    return vec4(
+        mix(a.x, b.x, 1.0f - h),
+        mix(a.y, b.y, 1.0f - h),
+        mix(a.z, b.z, 1.0f - h),
+        mix(a.w, b.w, h) + t * h * (1.0f - h)
+    );
+}
+
+vec4 sUnionSDF(const vec4& a, const vec4& b, float t) {
+    const float h = clamp(0.5f + 0.5f * (a.w - b.w) / t, 0.0f, 1.0f);
+    return vec4(
+        mix(a.x, b.x, h),
+        mix(a.y, b.y, h),
+        mix(a.z, b.z, h),
+        mix(a.w, b.w, h) - t * h * (1.0f - h)
+    );
+}
+
+vec4 sDifferenceSDF(const vec4& a, const vec4& b, float t) {
+    const float h = clamp(0.5f - 0.5f * (a.w + b.w) / t, 0.0f, 1.0f);
+    return vec4(
+        mix(a.x, b.x, h),
+        mix(a.y, b.y, h),
+        mix(a.z, b.z, h),
+        mix(a.w, -b.w, h) + t * h * (1.0f - h)
+    );
+}
+
+Color checker(const Point& pos, const Color& col1, const Color& col2) {
+    return mod(floorf(pos.x) + floorf(pos.z), 2.0f) == 0.0f ? col1 : col2;
+}
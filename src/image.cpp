@@ -0,0 +1,204 @@
+/***************************************************************************************************
+ * @file  image.cpp
+ * @brief Implementation of functions to write rendered images to files
+ **************************************************************************************************/
+
+#include "image.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+/**
+ * @brief Converts a color to 8 bits per channel.
+ * @param color The color, whose components are clamped between 0 and 1.
+ * @param bytes The array the three channels are written to.
+ */
+static void toBytes(const Color& color, uint8_t* bytes) {
+    bytes[0] = static_cast<uint8_t>(lroundf(fminf(fmaxf(color.x, 0.0f), 1.0f) * 255.0f));
+    bytes[1] = static_cast<uint8_t>(lroundf(fminf(fmaxf(color.y, 0.0f), 1.0f) * 255.0f));
+    bytes[2] = static_cast<uint8_t>(lroundf(fminf(fmaxf(color.z, 0.0f), 1.0f) * 255.0f));
+}
+
+/**
+ * @brief Opens a binary file for writing, throwing if it fails.
+ * @param path The path of the file.
+ * @return The opened file.
+ */
+static std::ofstream openFile(const std::filesystem::path& path) {
+    std::ofstream file(path, std::ios::binary);
+    if(!file.is_open()) {
+        throw std::runtime_error("Couldn't open \"" + path.string() + "\".");
+    }
+
+    return file;
+}
+
+void writePPM(const std::filesystem::path& path,
+              unsigned int width, unsigned int height,
+              const std::vector<Color>& pixels) {
+    std::ofstream file = openFile(path);
+    file << "P6\n" << width << ' ' << height << "\n255\n";
+
+    std::vector<uint8_t> row(3 * width);
+    for(unsigned int y = 0 ; y < height ; ++y) {
+        for(unsigned int x = 0 ; x < width ; ++x) {
+            toBytes(pixels[y * width + x], &row[3 * x]);
+        }
+
+        file.write(reinterpret_cast<const char*>(row.data()), row.size());
+    }
+
+    if(!file) {
+        throw std::runtime_error("Failed to write \"" + path.string() + "\".");
+    }
+}
+
+/**
+ * @brief Calculates the CRC-32 used by PNG chunks.
+ * @param crc The CRC of the previous data, or 0xFFFFFFFF to start a new one.
+ * @param data The data.
+ * @param size The size of the data in bytes.
+ * @return The updated CRC, which needs to be inverted once all the data was processed.
+ */
+static uint32_t updateCRC(uint32_t crc, const uint8_t* data, size_t size) {
+    static const std::array<uint32_t, 256> table = [] {
+        std::array<uint32_t, 256> result{};
+
+        for(uint32_t i = 0 ; i < 256 ; ++i) {
+            uint32_t c = i;
+            for(int k = 0 ; k < 8 ; ++k) {
+                c = (c & 1u) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+
+            result[i] = c;
+        }
+
+        return result;
+    }();
+
+    for(size_t i = 0 ; i < size ; ++i) {
+        crc = table[(crc ^ data[i]) & 0xFFu] ^ (crc >> 8);
+    }
+
+    return crc;
+}
+
+/**
+ * @brief Appends an unsigned integer in big-endian order.
+ * @param data The buffer to append to.
+ * @param value The value.
+ */
+static void appendBigEndian(std::vector<uint8_t>& data, uint32_t value) {
+    data.push_back(value >> 24);
+    data.push_back(value >> 16);
+    data.push_back(value >> 8);
+    data.push_back(value);
+}
+
+/**
+ * @brief Writes a PNG chunk.
+ * @param file The file to write to.
+ * @param type The four letters type of the chunk.
+ * @param data The content of the chunk.
+ */
+static void writeChunk(std::ofstream& file, const char* type, const std::vector<uint8_t>& data) {
+    std::vector<uint8_t> chunk;
+    chunk.reserve(data.size() + 12);
+
+    appendBigEndian(chunk, data.size());
+    chunk.insert(chunk.end(), type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    appendBigEndian(chunk, ~updateCRC(0xFFFFFFFFu, chunk.data() + 4, chunk.size() - 4));
+
+    file.write(reinterpret_cast<const char*>(chunk.data()), chunk.size());
+}
+
+void writePNG(const std::filesystem::path& path,
+              unsigned int width, unsigned int height,
+              const std::vector<Color>& pixels) {
+    std::ofstream file = openFile(path);
+
+    static const uint8_t signature[8] {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    file.write(reinterpret_cast<const char*>(signature), sizeof(signature));
+
+    /**** Header ****/
+    std::vector<uint8_t> header;
+    appendBigEndian(header, width);
+    appendBigEndian(header, height);
+    header.push_back(8); // Bit depth
+    header.push_back(2); // Color type: RGB
+    header.push_back(0); // Compression method: deflate
+    header.push_back(0); // Filter method
+    header.push_back(0); // Interlace method: none
+    writeChunk(file, "IHDR", header);
+
+    /**** Scanlines ****/
+    const size_t rowSize = 1 + 3 * width;
+    std::vector<uint8_t> raw(rowSize * height);
+    for(unsigned int y = 0 ; y < height ; ++y) {
+        uint8_t* row = &raw[y * rowSize];
+        row[0] = 0; // Filter type: none
+
+        for(unsigned int x = 0 ; x < width ; ++x) {
+            toBytes(pixels[y * width + x], row + 1 + 3 * x);
+        }
+    }
+
+    /**** Zlib stream made of stored deflate blocks ****/
+    constexpr size_t MAX_BLOCK_SIZE = 65535;
+
+    std::vector<uint8_t> zlib;
+    zlib.reserve(raw.size() + 5 * (raw.size() / MAX_BLOCK_SIZE + 1) + 6);
+    zlib.push_back(0x78);
+    zlib.push_back(0x01);
+
+    for(size_t offset = 0 ; offset < raw.size() ; offset += MAX_BLOCK_SIZE) {
+        const size_t size = std::min(MAX_BLOCK_SIZE, raw.size() - offset);
+        const bool isLast = offset + size == raw.size();
+
+        zlib.push_back(isLast ? 1 : 0);
+        zlib.push_back(size & 0xFFu);
+        zlib.push_back(size >> 8);
+        zlib.push_back(~size & 0xFFu);
+        zlib.push_back((~size >> 8) & 0xFFu);
+        zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + size);
+    }
+
+    uint32_t a = 1, b = 0;
+    for(uint8_t byte: raw) {
+        a = (a + byte) % 65521u;
+        b = (b + a) % 65521u;
+    }
+    appendBigEndian(zlib, (b << 16) | a);
+
+    writeChunk(file, "IDAT", zlib);
+    writeChunk(file, "IEND", {});
+
+    if(!file) {
+        throw std::runtime_error("Failed to write \"" + path.string() + "\".");
+    }
+}
+
+void writeImage(const std::filesystem::path& path,
+                unsigned int width, unsigned int height,
+                const std::vector<Color>& pixels) {
+    if(pixels.size() != static_cast<size_t>(width) * height) {
+        throw std::runtime_error("The image size doesn't match its number of pixels.");
+    }
+
+    const std::string extension = path.extension().string();
+
+    if(extension == ".ppm") {
+        writePPM(path, width, height, pixels);
+    } else if(extension == ".png") {
+        writePNG(path, width, height, pixels);
+    } else {
+        throw std::runtime_error("Unsupported image format \"" + extension
+                                 + "\", expected \".ppm\" or \".png\".");
+    }
+}
@@ -8,15 +8,28 @@
 #include <iostream>
 #include <stdexcept>
 
-Application app;
+#include "Options.hpp"
 
-int main() {
+Application* app = nullptr;
+
+int main(int argc, char* argv[]) {
     try {
-        app.run();
+        const Options options = parseOptions(argc, argv);
+
+        if(options.help) {
+            printUsage(std::cout, argv[0]);
+            return 0;
+        }
+
+        app = new Application(options);
+        app->run();
     } catch(const std::exception& exception) {
         std::cerr << "ERROR : " << exception.what() << '\n';
+
+        delete app;
         return -1;
     }
 
+    delete app;
     return 0;
 }
\ No newline at end of file